@@ -16,5 +16,5 @@ if(BUILD_PIPER)
     ExternalProject_Add_StepDependencies(aprilasr configure onnx)
 endif()
 
-list(APPEND deps_libs "${external_lib_dir}/libaprilasr.so")
+list(APPEND april_plugin_libs "${external_lib_dir}/libaprilasr.so")
 list(APPEND deps aprilasr)
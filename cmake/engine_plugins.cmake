@@ -0,0 +1,63 @@
+# Engines with large dependencies are built as plugins loaded on demand
+# (see engine_plugin.hpp). Symbols shared with the app (tts_engine,
+# stt_engine, logger, text_tools, etc.) are resolved from the executable.
+
+function(add_engine_plugin name)
+    cmake_parse_arguments(plugin "" "" "SOURCES;LIBS" ${ARGN})
+
+    set(target "dsnote_${name}")
+
+    add_library(${target} MODULE ${plugin_SOURCES})
+    set_target_properties(${target} PROPERTIES PREFIX "lib")
+
+    # compiler_flags is not linked because its link options are for executable
+    target_compile_features(${target} PRIVATE cxx_std_17)
+    target_compile_options(${target} PRIVATE
+        $<TARGET_PROPERTY:compiler_flags,INTERFACE_COMPILE_OPTIONS>)
+    target_compile_definitions(${target} PRIVATE
+        $<TARGET_PROPERTY:compiler_flags,INTERFACE_COMPILE_DEFINITIONS>)
+    target_include_directories(${target} PRIVATE ${includes})
+    target_link_directories(${target} PRIVATE ${deps_dirs})
+    target_link_options(${target} PRIVATE
+        "-Wl,--disable-new-dtags;-Wl,-rpath,${rpath_install_dir};-Wl,--exclude-libs,ALL")
+    target_link_libraries(${target} ${plugin_LIBS})
+
+    if(deps)
+        add_dependencies(${target} ${deps})
+    endif()
+
+    add_dependencies(${info_binary_id} ${target})
+
+    add_custom_command(TARGET ${target} POST_BUILD
+        COMMAND $<$<CONFIG:Release>:${CMAKE_STRIP}>
+        ARGS --strip-unneeded $<TARGET_FILE:${target}>
+    )
+
+    install(TARGETS ${target} LIBRARY DESTINATION ${lib_install_dir})
+endfunction()
+
+add_engine_plugin(piper
+    SOURCES ${sources_dir}/piper_engine.hpp ${sources_dir}/piper_engine.cpp
+    LIBS ${piper_plugin_libs} ${espeak_plugin_libs})
+
+add_engine_plugin(espeak
+    SOURCES ${sources_dir}/espeak_engine.hpp ${sources_dir}/espeak_engine.cpp
+    LIBS ${espeak_plugin_libs})
+
+add_engine_plugin(rhvoice
+    SOURCES ${sources_dir}/rhvoice_engine.hpp ${sources_dir}/rhvoice_engine.cpp
+    LIBS ${rhvoice_plugin_libs})
+
+add_engine_plugin(april
+    SOURCES ${sources_dir}/april_engine.hpp ${sources_dir}/april_engine.cpp
+    LIBS ${april_plugin_libs})
+
+# smoke test, loads every plugin with all symbols resolved (RTLD_NOW)
+add_custom_target(check_engine_plugins
+    COMMAND ${CMAKE_COMMAND} -E env
+        "LD_LIBRARY_PATH=${PROJECT_BINARY_DIR}:${external_lib_dir}"
+        QT_QPA_PLATFORM=offscreen
+        $<TARGET_FILE:${info_binary_id}> --check-plugins
+    DEPENDS ${info_binary_id}
+    VERBATIM
+)
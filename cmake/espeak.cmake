@@ -34,5 +34,5 @@ ExternalProject_Add(espeak
 
 ExternalProject_Add_StepDependencies(espeak configure mbrola)
 
-list(APPEND deps_libs "${external_lib_dir}/libespeak-ng.a")
+list(APPEND espeak_plugin_libs "${external_lib_dir}/libespeak-ng.a")
 list(APPEND deps espeak mbrola)
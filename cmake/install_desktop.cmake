@@ -76,6 +76,13 @@ if(BUILD_PIPER OR BUILD_ESPEAK)
 endif()
 install(FILES "${PROJECT_BINARY_DIR}/espeakdata.tar.xz" DESTINATION ${module_install_dir})
 
+if(BUILD_RNNOISE)
+    foreach(variant ${rnnoise_variants})
+        strip_all("${external_lib_dir}/librnnoise-nu-${variant}.so")
+        install(FILES "${external_lib_dir}/librnnoise-nu-${variant}.so" DESTINATION ${lib_install_dir})
+    endforeach()
+endif()
+
 if(BUILD_RHVOICE)
     strip_all("${external_lib_dir}/libRHVoice_core.so.1.2.2")
     strip_all("${external_lib_dir}/libRHVoice.so.1.2.2")
@@ -16,6 +16,12 @@ if(BUILD_WHISPERCPP)
     install(FILES "${external_lib_dir}/libwhisper-fallback.so" DESTINATION DESTINATION ${lib_install_dir})
 endif()
 
+if(BUILD_RNNOISE)
+    foreach(variant ${rnnoise_variants})
+        install(FILES "${external_lib_dir}/librnnoise-nu-${variant}.so" DESTINATION ${lib_install_dir})
+    endforeach()
+endif()
+
 if(DOWNLOAD_LIBSTT)
     install(FILES "${external_lib_dir}/libstt.so" DESTINATION ${lib_install_dir})
     install(FILES "${external_lib_dir}/libkenlm.so" DESTINATION ${lib_install_dir})
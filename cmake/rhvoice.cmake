@@ -26,5 +26,5 @@ ExternalProject_Add(rhvoice
     BUILD_ALWAYS False
 )
 
-list(APPEND deps_libs "${external_lib_dir}/libRHVoice_core.so.1" "${external_lib_dir}/libRHVoice.so.1")
+list(APPEND rhvoice_plugin_libs "${external_lib_dir}/libRHVoice_core.so.1" "${external_lib_dir}/libRHVoice.so.1")
 list(APPEND deps rhvoice)
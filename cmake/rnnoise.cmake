@@ -3,7 +3,8 @@ set(rnnoise_checksum "fafe9bbf0e2b15df4a628434bea99dd3")
 
 # adding prefix rnnoise_ to avoid symbol collision with libopus
 set(rnnoise_cflags
-    "-Dpitch_downsample=rnnoise_pitch_downsample \
+    "-O3 \
+    -Dpitch_downsample=rnnoise_pitch_downsample \
     -Dpitch_search=rnnoise_pitch_search \
     -Dremove_doubling=rnnoise_remove_doubling \
     -D_celt_lpc=rnnoise__celt_lpc \
@@ -12,21 +13,42 @@ set(rnnoise_cflags
     -Dcompute_gru=rnnoise_compute_gru \
     -Dcompute_dense=rnnoise_compute_dense")
 
-ExternalProject_Add(rnnoise
-    SOURCE_DIR ${external_dir}/rnnoise
-    BINARY_DIR ${PROJECT_BINARY_DIR}/external/rnnoise
-    INSTALL_DIR ${PROJECT_BINARY_DIR}/external
-    URL "${rnnoise_source_url}"
-    URL_MD5 "${rnnoise_checksum}"
-    CONFIGURE_COMMAND cp -r --no-target-directory <SOURCE_DIR> <BINARY_DIR> && <BINARY_DIR>/autogen.sh &&
-        <BINARY_DIR>/configure --prefix=<INSTALL_DIR>
-        --disable-examples --disable-doc --disable-shared --enable-static --with-pic
-        CFLAGS=${rnnoise_cflags}
-    BUILD_COMMAND ${MAKE}
-    BUILD_ALWAYS False
-    INSTALL_COMMAND make DESTDIR=/ install
-)
+# builds librnnoise-nu-<variant>.so, variant is chosen in run-time (denoiser.cpp)
+function(add_rnnoise_variant variant flags)
+    ExternalProject_Add(rnnoise${variant}
+        SOURCE_DIR ${external_dir}/rnnoise${variant}
+        BINARY_DIR ${PROJECT_BINARY_DIR}/external/rnnoise${variant}
+        INSTALL_DIR ${PROJECT_BINARY_DIR}/external
+        URL "${rnnoise_source_url}"
+        URL_MD5 "${rnnoise_checksum}"
+        CONFIGURE_COMMAND cp -r --no-target-directory <SOURCE_DIR> <BINARY_DIR> &&
+            sed -i -e "s/librnnoise-nu.la/librnnoise-nu-${variant}.la/g"
+                -e "s/librnnoise_nu_la/librnnoise_nu_${variant}_la/g" <BINARY_DIR>/Makefile.am &&
+            <BINARY_DIR>/autogen.sh &&
+            <BINARY_DIR>/configure --prefix=<INSTALL_DIR>
+            --disable-examples --disable-doc --enable-shared --disable-static
+            "CFLAGS=${rnnoise_cflags} ${flags}"
+        BUILD_COMMAND ${MAKE}
+        BUILD_ALWAYS False
+        INSTALL_COMMAND mkdir -p ${external_include_dir} ${external_lib_dir} &&
+            cp <BINARY_DIR>/include/rnnoise-nu.h ${external_include_dir} &&
+            cp -L <BINARY_DIR>/.libs/librnnoise-nu-${variant}.so ${external_lib_dir}
+    )
 
-list(APPEND deps_libs "${external_lib_dir}/librnnoise-nu.a")
+    list(APPEND deps rnnoise${variant})
+    set(deps ${deps} PARENT_SCOPE)
+    list(APPEND rnnoise_variants ${variant})
+    set(rnnoise_variants ${rnnoise_variants} PARENT_SCOPE)
+endfunction()
 
-list(APPEND deps rnnoise)
+set(rnnoise_variants "")
+
+add_rnnoise_variant(fallback "")
+
+if(arch_x8664)
+    add_rnnoise_variant(avx2 "-mavx -mavx2 -mfma -mf16c")
+elseif(arch_arm32)
+    # NEON doesn't support IEEE 754 denormals, so float vectorization needs
+    # unsafe math
+    add_rnnoise_variant(neon "-mfpu=neon -funsafe-math-optimizations")
+endif()
@@ -23,6 +23,14 @@ add_executable(tests ${tests_src})
 target_link_libraries(tests Catch2::Catch2WithMain)
 target_link_libraries(tests dsnote_lib)
 
+# dbus load test, run it with tests/dbus_load/run_dbus_load_test.sh
+
+add_executable(dbus_load_test
+    "${tests_dir}/dbus_load/dbus_load_test.cpp"
+    "${sources_dir}/dbus_speech_inf.cpp"
+    "${sources_dir}/dbus_speech_inf.h"
+)
+
 list(APPEND CMAKE_MODULE_PATH ${catch2_SOURCE_DIR}/extras)
 
 # run tests in build step
@@ -360,6 +360,133 @@ DialogPage {
                         .arg("<i>" + qsTr("Restore punctuation") + "</i>").arg("<i>" + qsTr("Punctuation") + "</i>")
             }
 
+            CheckBox {
+                checked: _settings.stt_low_latency
+                text: qsTr("Low latency")
+                onCheckedChanged: {
+                    _settings.stt_low_latency = checked
+                }
+
+                ToolTip.delay: Qt.styleHints.mousePressAndHoldInterval
+                ToolTip.visible: hovered
+                ToolTip.text: qsTr("Process audio from the microphone in small chunks, so that recognized text appears sooner.") + " " +
+                              qsTr("When this option is enabled CPU usage is higher.")
+            }
+
+            CheckBox {
+                checked: _settings.stt_native_endpointing
+                text: qsTr("Use engine's own end of speech detection")
+                onCheckedChanged: {
+                    _settings.stt_native_endpointing = checked
+                }
+
+                ToolTip.delay: Qt.styleHints.mousePressAndHoldInterval
+                ToolTip.visible: hovered
+                ToolTip.text: qsTr("Audio is passed directly to the speech recognition engine, which detects the end of a sentence on its own.") + " " +
+                              qsTr("This option is only supported by %1 and %2 models.").arg("<i>Vosk</i>").arg("<i>April-ASR</i>")
+            }
+
+            CheckBox {
+                checked: _settings.stt_cascade
+                text: qsTr("Show live preview when using %1 models").arg("Whisper")
+                onCheckedChanged: {
+                    _settings.stt_cascade = checked
+                }
+
+                ToolTip.delay: Qt.styleHints.mousePressAndHoldInterval
+                ToolTip.visible: hovered
+                ToolTip.text: qsTr("While you speak, a fast model for the same language shows the text that is being recognized. The final text always comes from the %1 model.").arg("Whisper") + " " +
+                              qsTr("To make it work, download a %1, %2 or %3 model for your language.").arg("<i>Vosk</i>").arg("<i>April-ASR</i>").arg("<i>DeepSpeech</i>")
+            }
+
+            GridLayout {
+                columns: root.verticalMode ? 1 : 2
+                columnSpacing: appWin.padding
+                rowSpacing: appWin.padding
+
+                Label {
+                    Layout.fillWidth: true
+                    text: qsTr("Decoding profile for speech from microphone")
+                }
+                ComboBox {
+                    Layout.fillWidth: verticalMode
+                    Layout.preferredWidth: verticalMode ? grid.width : grid.width / 2
+                    Layout.leftMargin: verticalMode ? appWin.padding : 0
+                    currentIndex: {
+                        switch(_settings.stt_live_decoding_profile) {
+                        case Settings.DecodingProfileFast: return 0
+                        case Settings.DecodingProfileBalanced: return 1
+                        case Settings.DecodingProfileAccurate: return 2
+                        }
+                        return 0
+                    }
+                    model: [
+                        qsTr("Fast"),
+                        qsTr("Balanced"),
+                        qsTr("Accurate")
+                    ]
+                    onActivated: {
+                        if (index === 0) {
+                            _settings.stt_live_decoding_profile = Settings.DecodingProfileFast
+                        } else if (index === 1) {
+                            _settings.stt_live_decoding_profile = Settings.DecodingProfileBalanced
+                        } else if (index === 2) {
+                            _settings.stt_live_decoding_profile = Settings.DecodingProfileAccurate
+                        }
+                    }
+
+                    ToolTip.delay: Qt.styleHints.mousePressAndHoldInterval
+                    ToolTip.visible: hovered
+                    ToolTip.text: qsTr("Decoding settings used when you dictate.") + " " +
+                                  qsTr("<i>Fast</i> gives the shortest response time. <i>Accurate</i> uses beam search, which is slower but makes fewer mistakes.") + " " +
+                                  qsTr("This option only applies to %1 and %2 models.").arg("Whisper").arg("FasterWhisper")
+                }
+            }
+
+            GridLayout {
+                columns: root.verticalMode ? 1 : 2
+                columnSpacing: appWin.padding
+                rowSpacing: appWin.padding
+
+                Label {
+                    Layout.fillWidth: true
+                    text: qsTr("Decoding profile for file transcription")
+                }
+                ComboBox {
+                    Layout.fillWidth: verticalMode
+                    Layout.preferredWidth: verticalMode ? grid.width : grid.width / 2
+                    Layout.leftMargin: verticalMode ? appWin.padding : 0
+                    currentIndex: {
+                        switch(_settings.stt_file_decoding_profile) {
+                        case Settings.DecodingProfileFast: return 0
+                        case Settings.DecodingProfileBalanced: return 1
+                        case Settings.DecodingProfileAccurate: return 2
+                        }
+                        return 0
+                    }
+                    model: [
+                        qsTr("Fast"),
+                        qsTr("Balanced"),
+                        qsTr("Accurate")
+                    ]
+                    onActivated: {
+                        if (index === 0) {
+                            _settings.stt_file_decoding_profile = Settings.DecodingProfileFast
+                        } else if (index === 1) {
+                            _settings.stt_file_decoding_profile = Settings.DecodingProfileBalanced
+                        } else if (index === 2) {
+                            _settings.stt_file_decoding_profile = Settings.DecodingProfileAccurate
+                        }
+                    }
+
+                    ToolTip.delay: Qt.styleHints.mousePressAndHoldInterval
+                    ToolTip.visible: hovered
+                    ToolTip.text: qsTr("Decoding settings used when an audio file is transcribed.") + " " +
+                                  qsTr("<i>Fast</i> gives the shortest response time. <i>Accurate</i> uses beam search, which is slower but makes fewer mistakes.") + " " +
+                                  qsTr("This option only applies to %1 and %2 models.").arg("Whisper").arg("FasterWhisper")
+                }
+            }
+
             CheckBox {
                 visible: _settings.gpu_supported() && app.feature_gpu_stt
                 checked: _settings.stt_use_gpu
@@ -447,6 +574,19 @@ DialogPage {
                 text: qsTr("Diacritics restoration for Hebrew language is not available.")
             }
 
+            CheckBox {
+                checked: _settings.tts_prerender
+                text: qsTr("Prepare speech while typing")
+                onCheckedChanged: {
+                    _settings.tts_prerender = checked
+                }
+
+                ToolTip.delay: Qt.styleHints.mousePressAndHoldInterval
+                ToolTip.visible: hovered
+                ToolTip.text: qsTr("When you stop typing, the first sentences of the note and the sentences you have changed are synthesized in the background with low priority.") + " " +
+                              qsTr("Playback of the note starts without delay, but additional CPU time and disk space are used.")
+            }
+
             CheckBox {
                 checked: _settings.tts_use_gpu
                 visible: _settings.gpu_supported() && app.feature_gpu_tts
@@ -849,6 +989,49 @@ DialogPage {
                     ToolTip.visible: hovered
                     ToolTip.text: qsTr("Set the maximum number of simultaneous CPU threads.")
                 }
+
+                Label {
+                    Layout.fillWidth: true
+                    text: qsTr("Performance profile")
+                    wrapMode: Text.Wrap
+                }
+                ComboBox {
+                    Layout.fillWidth: verticalMode
+                    Layout.preferredWidth: verticalMode ? grid.width : grid.width / 2
+                    Layout.leftMargin: verticalMode ? appWin.padding : 0
+                    currentIndex: {
+                        switch(_settings.performance_profile) {
+                        case Settings.PerformanceProfileAuto: return 0
+                        case Settings.PerformanceProfilePowerSaver: return 1
+                        case Settings.PerformanceProfileBalanced: return 2
+                        case Settings.PerformanceProfileMaxThroughput: return 3
+                        }
+                        return 0
+                    }
+                    model: [
+                        qsTr("Auto"),
+                        qsTr("Power saver"),
+                        qsTr("Balanced"),
+                        qsTr("Maximum throughput")
+                    ]
+                    onActivated: {
+                        if (index === 0) {
+                            _settings.performance_profile = Settings.PerformanceProfileAuto
+                        } else if (index === 1) {
+                            _settings.performance_profile = Settings.PerformanceProfilePowerSaver
+                        } else if (index === 2) {
+                            _settings.performance_profile = Settings.PerformanceProfileBalanced
+                        } else if (index === 3) {
+                            _settings.performance_profile = Settings.PerformanceProfileMaxThroughput
+                        }
+                    }
+
+                    ToolTip.delay: Qt.styleHints.mousePressAndHoldInterval
+                    ToolTip.visible: hovered
+                    ToolTip.text: qsTr("<i>Power saver</i> uses fewer threads, the fast decoding profile for speech from microphone and skips optional background work.") + " " +
+                                  qsTr("<i>Maximum throughput</i> uses all CPU cores.") + " " +
+                                  qsTr("<i>Auto</i> switches to <i>Power saver</i> when running on battery or when the CPU is thermally throttled.")
+                }
             }
 
             SectionLabel {
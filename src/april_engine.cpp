@@ -18,6 +18,7 @@
 #include <array>
 #include <chrono>
 
+#include "engine_plugin.hpp"
 #include "logger.hpp"
 #include "text_tools.hpp"
 
@@ -85,6 +86,7 @@ void april_engine::reset_impl() {
     if (m_session) aas_flush(m_session);
     m_result.clear();
     m_result_prev_segment.clear();
+    m_endpoint = false;
 }
 
 void april_engine::push_inbuf_to_samples() {
@@ -97,6 +99,8 @@ stt_engine::samples_process_result_t april_engine::process_buff() {
     if (!lock_buff_for_processing())
         return samples_process_result_t::wait_for_samples;
 
+    if (m_config.native_endpointing) return process_buff_native_endpointing();
+
     auto eof = m_in_buf.eof;
     auto sof = m_in_buf.sof;
 
@@ -114,10 +118,9 @@ stt_engine::samples_process_result_t april_engine::process_buff() {
         m_result_prev_segment.clear();
     }
 
-    m_denoiser.process(m_in_buf.buf.data(), m_in_buf.size);
+    denoise_in_buf();
 
-    const auto& vad_buf =
-        m_vad.remove_silence(m_in_buf.buf.data(), m_in_buf.size);
+    const auto& vad_buf = remove_silence_from_in_buf();
 
     m_in_buf.clear();
 
@@ -189,6 +192,96 @@ stt_engine::samples_process_result_t april_engine::process_buff() {
     return samples_process_result_t::wait_for_samples;
 }
 
+// Audio is fed to the session as it arrives and the end of utterance is
+// detected by april itself. VAD is used only to update speech detection
+// status.
+stt_engine::samples_process_result_t
+april_engine::process_buff_native_endpointing() {
+    auto eof = m_in_buf.eof;
+    auto sof = m_in_buf.sof;
+
+    LOGD("process samples buf (native endpointing): mode="
+         << m_config.speech_mode << ", in-buf size=" << m_in_buf.size
+         << ", sof=" << sof << ", eof=" << eof);
+
+    if (sof) {
+        m_start_time.reset();
+        m_vad.reset();
+        if (m_session) aas_flush(m_session);
+        m_result.clear();
+        m_result_prev_segment.clear();
+    }
+
+    denoise_in_buf();
+
+    bool vad_status = m_vad.is_speech(m_in_buf.buf.data(), m_in_buf.size);
+
+    if (vad_status) {
+        LOGD("vad: speech detected");
+
+        if (m_config.speech_mode != speech_mode_t::manual &&
+            m_config.speech_mode != speech_mode_t::single_sentence)
+            set_speech_detection_status(
+                speech_detection_status_t::speech_detected);
+
+        restart_sentence_timer();
+    } else {
+        LOGD("vad: no speech");
+
+        if (m_config.speech_mode == speech_mode_t::single_sentence &&
+            (!m_intermediate_text || m_intermediate_text->empty()) &&
+            sentence_timer_timed_out()) {
+            LOGD("sentence timeout");
+            m_call_backs.sentence_timeout();
+        }
+    }
+
+    if (m_thread_exit_requested) {
+        m_in_buf.clear();
+        free_buf();
+        return samples_process_result_t::no_samples_needed;
+    }
+
+    set_processing_state(processing_state_t::decoding);
+
+    m_endpoint = false;
+
+    m_speech_buf.clear();
+    push_inbuf_to_samples();
+    m_in_buf.clear();
+
+    decode_speech(m_speech_buf, eof);
+
+    m_speech_buf.clear();
+
+    if (m_config.speech_started) set_processing_state(processing_state_t::idle);
+
+    // in manual mode utterances are joined until speech is stopped, so
+    // decoded segments are kept in m_result_prev_segment; endpoint on
+    // silence doesn't end single sentence
+    auto has_text = m_intermediate_text && !m_intermediate_text->empty();
+    auto final_decode =
+        eof || (m_endpoint && m_config.speech_mode != speech_mode_t::manual &&
+                (has_text ||
+                 m_config.speech_mode != speech_mode_t::single_sentence));
+
+    if (final_decode) {
+        m_result_prev_segment.clear();
+        flush(!eof && m_config.speech_mode == speech_mode_t::automatic
+                  ? flush_t::regular
+                  : flush_t::eof);
+    }
+
+    if (!vad_status && !final_decode &&
+        m_config.speech_mode == speech_mode_t::automatic &&
+        (!m_intermediate_text || m_intermediate_text->empty()))
+        set_speech_detection_status(speech_detection_status_t::no_speech);
+
+    free_buf();
+
+    return samples_process_result_t::wait_for_samples;
+}
+
 void april_engine::decode_handler(void* user_data, AprilResultType result_type,
                                   size_t count, const AprilToken* tokens) {
     if (tokens && (result_type == APRIL_RESULT_RECOGNITION_FINAL ||
@@ -205,6 +298,7 @@ void april_engine::decode_handler(void* user_data, AprilResultType result_type,
         if (result_type == APRIL_RESULT_RECOGNITION_FINAL) {
             engine->m_result_prev_segment.append(std::move(engine->m_result));
             engine->m_result.clear();
+            engine->m_endpoint = true;
         }
     }
 }
@@ -227,7 +321,7 @@ void april_engine::decode_speech(april_buf_t& buf, bool eof) {
     rtrim(result);
 
     if (m_punctuator) {
-        result = m_punctuator->process(result);
+        result = m_punctuator->process_incremental(result);
     } else {
         text_tools::restore_caps(result);
     }
@@ -238,3 +332,5 @@ void april_engine::decode_speech(april_buf_t& buf, bool eof) {
 
     if (eof) m_result_prev_segment.clear();
 }
+
+ENGINE_PLUGIN_STT(april_engine)
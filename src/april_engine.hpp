@@ -35,9 +35,11 @@ class april_engine : public stt_engine {
     april_buf_t m_speech_buf;
     std::string m_result;
     std::string m_result_prev_segment;
+    bool m_endpoint = false;
 
     void create_model();
     samples_process_result_t process_buff() override;
+    samples_process_result_t process_buff_native_endpointing();
     void decode_speech(april_buf_t& buf, bool eof);
     void reset_impl() override;
     void start_processing_impl() override;
@@ -12,9 +12,13 @@
 #include <lzma.h>
 #include <zlib.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <fstream>
+#include <optional>
 #include <thread>
+#include <vector>
 
 #include "cpu_tools.hpp"
 
@@ -42,6 +46,76 @@ static int copy_data(struct archive* ar, struct archive* aw) {
     }
 }
 
+// returns number of decoder threads or 0 on error
+static uint32_t init_xz_decoder(lzma_stream* strm) {
+    lzma_mt opts{};
+    opts.flags = 0;
+    opts.threads = std::min(6u, std::thread::hardware_concurrency());
+    opts.timeout = 300;
+    opts.memlimit_threading = lzma_physmem() / 4;
+    opts.memlimit_stop = lzma_physmem() / 2;
+
+    if (lzma_ret ret = lzma_stream_decoder_mt(strm, &opts); ret != LZMA_OK) {
+        qWarning() << "error initializing the xz decoder:" << ret;
+        return 0;
+    }
+
+    return std::max(1u, opts.threads);
+}
+
+// multi-threaded xz decoder used as libarchive read callback, so tar.xz
+// archive is extracted without intermediate tar file
+struct xz_reader {
+    std::ifstream input;
+    lzma_stream strm = LZMA_STREAM_INIT;
+    std::vector<char> buff_in =
+        std::vector<char>(std::numeric_limits<unsigned short>::max());
+    std::vector<char> buff_out =
+        std::vector<char>(std::numeric_limits<unsigned short>::max() * 16);
+    bool finished = false;
+
+    explicit xz_reader(const QString& file_in)
+        : input{file_in.toStdString(), std::ios::in | std::ifstream::binary} {}
+    ~xz_reader() { lzma_end(&strm); }
+};
+
+static la_ssize_t xz_read_callback(struct archive* a, void* client_data,
+                                   const void** buff) {
+    auto* reader = static_cast<xz_reader*>(client_data);
+
+    if (reader->finished) return 0;
+
+    auto& strm = reader->strm;
+
+    strm.next_out = reinterpret_cast<uint8_t*>(reader->buff_out.data());
+    strm.avail_out = reader->buff_out.size();
+
+    while (strm.avail_out > 0) {
+        if (strm.avail_in == 0 && reader->input) {
+            strm.next_in = reinterpret_cast<uint8_t*>(reader->buff_in.data());
+            reader->input.read(reader->buff_in.data(),
+                               reader->buff_in.size());
+            strm.avail_in = reader->input.gcount();
+        }
+
+        auto ret = lzma_code(&strm, reader->input ? LZMA_RUN : LZMA_FINISH);
+
+        if (ret == LZMA_STREAM_END) {
+            reader->finished = true;
+            break;
+        }
+
+        if (ret != LZMA_OK) {
+            archive_set_error(a, EIO, "xz decoder error: %d", ret);
+            return -1;
+        }
+    }
+
+    *buff = reader->buff_out.data();
+
+    return reader->buff_out.size() - strm.avail_out;
+}
+
 bool xz_decode(const QString& file_in, const QString& file_out) {
     qDebug() << "extracting xz archive:" << file_in;
 
@@ -65,18 +139,9 @@ bool xz_decode(const QString& file_in, const QString& file_out) {
 
     auto decoding_start = std::chrono::steady_clock::now();
 
-    lzma_mt opts{};
-    opts.flags = 0;
-    opts.threads = std::min(6u, std::thread::hardware_concurrency());
-    opts.timeout = 300;
-    opts.memlimit_threading = lzma_physmem() / 4;
-    opts.memlimit_stop = lzma_physmem() / 2;
-
     lzma_stream strm = LZMA_STREAM_INIT;
-    if (lzma_ret ret = lzma_stream_decoder_mt(&strm, &opts); ret != LZMA_OK) {
-        qWarning() << "error initializing the xz decoder:" << ret;
-        return false;
-    }
+    auto threads = init_xz_decoder(&strm);
+    if (threads == 0) return false;
 
     lzma_action action = LZMA_RUN;
 
@@ -122,7 +187,7 @@ bool xz_decode(const QString& file_in, const QString& file_out) {
                             .count();
 
     qDebug() << "xz decoded, stats: size=" << file_size
-             << ", duration=" << decoding_dur << ", threads=" << opts.threads;
+             << ", duration=" << decoding_dur << ", threads=" << threads;
 
     return true;
 }
@@ -198,34 +263,63 @@ bool gz_decode(const QString& file_in, const QString& file_out) {
     return true;
 }
 
-bool archive_decode(const QString& file_in, archive_type type,
-                    files_to_extract&& files_out, bool ignore_first_dir) {
-    qDebug() << "extracting archive:" << file_in;
-
-    struct archive* a = archive_read_new();
-    struct archive* ext = archive_write_disk_new();
-
+static bool open_archive(struct archive* a, const QString& file_in,
+                         archive_type type, xz_reader* reader) {
     switch (type) {
         case archive_type::tar:
+        case archive_type::tarxz:
             archive_read_support_format_tar(a);
             break;
         case archive_type::zip:
-            archive_read_support_format_zip(a);
+            archive_read_support_format_zip_seekable(a);
             break;
         default:
             throw std::runtime_error("unsupported archive type");
     }
 
-    bool ok = true;
+    if (type == archive_type::tarxz) {
+        if (!reader->input) {
+            qWarning() << "error opening in-file:" << file_in;
+            return false;
+        }
+
+        if (init_xz_decoder(&reader->strm) == 0) return false;
+
+        if (archive_read_open(a, reader, nullptr, xz_read_callback, nullptr)) {
+            qWarning() << "error opening in-file:" << file_in
+                       << archive_error_string(a);
+            return false;
+        }
+
+        return true;
+    }
 
     if (archive_read_open_filename(a, file_in.toStdString().c_str(), 10240)) {
         qWarning() << "error opening in-file:" << file_in
                    << archive_error_string(a);
-        ok = false;
-    } else {
+        return false;
+    }
+
+    return true;
+}
+
+// extracts every worker_count-th entry starting from worker_idx
+static bool extract_entries(const QString& file_in, archive_type type,
+                            const files_to_extract& files_out,
+                            bool ignore_first_dir, size_t worker_idx,
+                            size_t worker_count) {
+    struct archive* a = archive_read_new();
+    struct archive* ext = archive_write_disk_new();
+
+    std::optional<xz_reader> reader;
+    if (type == archive_type::tarxz) reader.emplace(file_in);
+
+    bool ok = open_archive(a, file_in, type, reader ? &*reader : nullptr);
+
+    if (ok) {
         archive_entry* entry{};
 
-        while (true) {
+        for (size_t idx = 0;; ++idx) {
             int ret = archive_read_next_header(a, &entry);
             if (ret == ARCHIVE_EOF) break;
             if (ret != ARCHIVE_OK) {
@@ -235,6 +329,8 @@ bool archive_decode(const QString& file_in, archive_type type,
                 break;
             }
 
+            if (idx % worker_count != worker_idx) continue;
+
             QString entry_path{archive_entry_pathname_utf8(entry)};
 
             //            qDebug() << "found file in archive:" << entry_path
@@ -254,7 +350,6 @@ bool archive_decode(const QString& file_in, archive_type type,
 
                 auto it = files_out.files.find(entry_path);
                 if (it == files_out.files.cend()) return {};
-                files_out.files.erase(it);
                 return it->second;
             }();
 
@@ -293,4 +388,50 @@ bool archive_decode(const QString& file_in, archive_type type,
 
     return ok;
 }
+
+bool archive_decode(const QString& file_in, archive_type type,
+                    files_to_extract&& files_out, bool ignore_first_dir) {
+    qDebug() << "extracting archive:" << file_in;
+
+    auto decoding_start = std::chrono::steady_clock::now();
+
+    // Zip entries are compressed independently, so each worker opens
+    // the archive and extracts its own subset of entries. Tar entries can
+    // only be read sequentially.
+    size_t worker_count =
+        type == archive_type::zip && files_out.files.size() != 1
+            ? std::clamp(std::thread::hardware_concurrency(), 1u, 4u)
+            : 1;
+
+    bool ok = true;
+
+    if (worker_count == 1) {
+        ok = extract_entries(file_in, type, files_out, ignore_first_dir, 0, 1);
+    } else {
+        std::atomic_bool workers_ok = true;
+        std::vector<std::thread> workers;
+        workers.reserve(worker_count);
+
+        for (size_t i = 0; i < worker_count; ++i) {
+            workers.emplace_back([&, i] {
+                if (!extract_entries(file_in, type, files_out,
+                                     ignore_first_dir, i, worker_count))
+                    workers_ok = false;
+            });
+        }
+
+        for (auto& worker : workers) worker.join();
+
+        ok = workers_ok;
+    }
+
+    auto decoding_dur = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now() - decoding_start)
+                            .count();
+
+    qDebug() << "archive extracted, stats: duration=" << decoding_dur
+             << ", workers=" << worker_count;
+
+    return ok;
+}
 }  // namespace comp_tools
@@ -26,7 +26,7 @@ struct hash<QString> {
 #endif
 
 namespace comp_tools {
-enum class archive_type { tar, zip };
+enum class archive_type { tar, tarxz, zip };
 
 struct files_to_extract {
     QString out_dir;
@@ -40,6 +40,8 @@ class coqui_engine : public tts_engine {
     void create_model() final;
     bool encode_speech_impl(const std::string& text,
                             const std::string& out_file) final;
+    // synthesis runs in py executor thread
+    bool prerender_supported() const final { return false; }
     void stop();
     static std::string fix_config_file(const std::string& config_file,
                                        const std::string& dir, bool vocoder);
@@ -123,6 +123,18 @@ QVariantMap SpeechAdaptor::mntLangs() const
     return qvariant_cast< QVariantMap >(parent()->property("MntLangs"));
 }
 
+int SpeechAdaptor::performanceProfile() const
+{
+    // get the value of property PerformanceProfile
+    return qvariant_cast< int >(parent()->property("PerformanceProfile"));
+}
+
+void SpeechAdaptor::setPerformanceProfile(int value)
+{
+    // set the value of property PerformanceProfile
+    parent()->setProperty("PerformanceProfile", QVariant::fromValue(value));
+}
+
 int SpeechAdaptor::state() const
 {
     // get the value of property State
@@ -251,6 +263,22 @@ int SpeechAdaptor::MntTranslate2(const QString &text, const QString &lang, const
     return task;
 }
 
+int SpeechAdaptor::MntTranslateBatch(const QStringList &texts, const QString &lang, const QString &out_lang, const QVariantMap &options)
+{
+    // handle method call org.mkiol.Speech.MntTranslateBatch
+    int task;
+    QMetaObject::invokeMethod(parent(), "MntTranslateBatch", Q_RETURN_ARG(int, task), Q_ARG(QStringList, texts), Q_ARG(QString, lang), Q_ARG(QString, out_lang), Q_ARG(QVariantMap, options));
+    return task;
+}
+
+int SpeechAdaptor::MntTranslateFd(const QDBusUnixFileDescriptor &text, const QString &lang, const QString &out_lang, const QVariantMap &options)
+{
+    // handle method call org.mkiol.Speech.MntTranslateFd
+    int task;
+    QMetaObject::invokeMethod(parent(), "MntTranslateFd", Q_RETURN_ARG(int, task), Q_ARG(QDBusUnixFileDescriptor, text), Q_ARG(QString, lang), Q_ARG(QString, out_lang), Q_ARG(QVariantMap, options));
+    return task;
+}
+
 int SpeechAdaptor::Reload()
 {
     // handle method call org.mkiol.Speech.Reload
@@ -275,6 +303,22 @@ int SpeechAdaptor::SttStartListen(int mode, const QString &lang, const QString &
     return task;
 }
 
+int SpeechAdaptor::SttStartListen2(int mode, const QString &lang, const QString &out_lang, const QVariantMap &options)
+{
+    // handle method call org.mkiol.Speech.SttStartListen2
+    int task;
+    QMetaObject::invokeMethod(parent(), "SttStartListen2", Q_RETURN_ARG(int, task), Q_ARG(int, mode), Q_ARG(QString, lang), Q_ARG(QString, out_lang), Q_ARG(QVariantMap, options));
+    return task;
+}
+
+int SpeechAdaptor::SttStartInterpret(const QString &lang, const QString &out_lang, const QVariantMap &options)
+{
+    // handle method call org.mkiol.Speech.SttStartInterpret
+    int task;
+    QMetaObject::invokeMethod(parent(), "SttStartInterpret", Q_RETURN_ARG(int, task), Q_ARG(QString, lang), Q_ARG(QString, out_lang), Q_ARG(QVariantMap, options));
+    return task;
+}
+
 int SpeechAdaptor::SttStopListen(int task)
 {
     // handle method call org.mkiol.Speech.SttStopListen
@@ -291,6 +335,14 @@ int SpeechAdaptor::SttTranscribeFile(const QString &file, const QString &lang, c
     return task;
 }
 
+int SpeechAdaptor::SttTranscribeFile2(const QString &file, const QString &lang, const QString &out_lang, const QVariantMap &options)
+{
+    // handle method call org.mkiol.Speech.SttTranscribeFile2
+    int task;
+    QMetaObject::invokeMethod(parent(), "SttTranscribeFile2", Q_RETURN_ARG(int, task), Q_ARG(QString, file), Q_ARG(QString, lang), Q_ARG(QString, out_lang), Q_ARG(QVariantMap, options));
+    return task;
+}
+
 double SpeechAdaptor::TtsGetSpeechToFileProgress(int task)
 {
     // handle method call org.mkiol.Speech.TtsGetSpeechToFileProgress
@@ -323,6 +375,22 @@ int SpeechAdaptor::TtsPlaySpeech2(const QString &text, const QString &lang, cons
     return task;
 }
 
+int SpeechAdaptor::TtsPlaySpeechFd(const QDBusUnixFileDescriptor &text, const QString &lang, const QVariantMap &options)
+{
+    // handle method call org.mkiol.Speech.TtsPlaySpeechFd
+    int task;
+    QMetaObject::invokeMethod(parent(), "TtsPlaySpeechFd", Q_RETURN_ARG(int, task), Q_ARG(QDBusUnixFileDescriptor, text), Q_ARG(QString, lang), Q_ARG(QVariantMap, options));
+    return task;
+}
+
+int SpeechAdaptor::TtsPrerenderSpeech(const QString &text, const QString &lang, const QVariantMap &options)
+{
+    // handle method call org.mkiol.Speech.TtsPrerenderSpeech
+    int result;
+    QMetaObject::invokeMethod(parent(), "TtsPrerenderSpeech", Q_RETURN_ARG(int, result), Q_ARG(QString, text), Q_ARG(QString, lang), Q_ARG(QVariantMap, options));
+    return result;
+}
+
 int SpeechAdaptor::TtsResumeSpeech(int task)
 {
     // handle method call org.mkiol.Speech.TtsResumeSpeech
@@ -339,6 +407,14 @@ int SpeechAdaptor::TtsSpeechToFile(const QString &text, const QString &lang, con
     return task;
 }
 
+int SpeechAdaptor::TtsSpeechToFileFd(const QDBusUnixFileDescriptor &text, const QString &lang, const QVariantMap &options)
+{
+    // handle method call org.mkiol.Speech.TtsSpeechToFileFd
+    int task;
+    QMetaObject::invokeMethod(parent(), "TtsSpeechToFileFd", Q_RETURN_ARG(int, task), Q_ARG(QDBusUnixFileDescriptor, text), Q_ARG(QString, lang), Q_ARG(QVariantMap, options));
+    return task;
+}
+
 int SpeechAdaptor::TtsStopSpeech(int task)
 {
     // handle method call org.mkiol.Speech.TtsStopSpeech
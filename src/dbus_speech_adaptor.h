@@ -64,6 +64,10 @@ class SpeechAdaptor: public QDBusAbstractAdaptor
 "    <signal name=\"DefaultMntOutLangPropertyChanged\">\n"
 "      <arg direction=\"out\" type=\"s\" name=\"lang\"/>\n"
 "    </signal>\n"
+"    <property access=\"readwrite\" type=\"i\" name=\"PerformanceProfile\"/>\n"
+"    <signal name=\"PerformanceProfilePropertyChanged\">\n"
+"      <arg direction=\"out\" type=\"i\" name=\"profile\"/>\n"
+"    </signal>\n"
 "    <property access=\"read\" type=\"a{sv}\" name=\"SttLangs\">\n"
 "      <annotation value=\"QVariantMap\" name=\"org.qtproject.QtDBus.QtTypeName\"/>\n"
 "    </property>\n"
@@ -170,6 +174,18 @@ class SpeechAdaptor: public QDBusAbstractAdaptor
 "      <arg direction=\"out\" type=\"s\" name=\"out_lang\"/>\n"
 "      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
 "    </signal>\n"
+"    <signal name=\"MntTranslateBatchFinished\">\n"
+"      <arg direction=\"out\" type=\"s\" name=\"in_lang\"/>\n"
+"      <arg direction=\"out\" type=\"as\" name=\"out_texts\"/>\n"
+"      <arg direction=\"out\" type=\"s\" name=\"out_lang\"/>\n"
+"      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
+"    </signal>\n"
+"    <signal name=\"MntTranslateFdFinished\">\n"
+"      <arg direction=\"out\" type=\"h\" name=\"out_text\"/>\n"
+"      <arg direction=\"out\" type=\"s\" name=\"in_lang\"/>\n"
+"      <arg direction=\"out\" type=\"s\" name=\"out_lang\"/>\n"
+"      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
+"    </signal>\n"
 "    <method name=\"SttGetFileTranscribeProgress\">\n"
 "      <arg direction=\"in\" type=\"i\" name=\"task\"/>\n"
 "      <arg direction=\"out\" type=\"d\" name=\"progress\"/>\n"
@@ -192,6 +208,22 @@ class SpeechAdaptor: public QDBusAbstractAdaptor
 "      <arg direction=\"in\" type=\"a{sv}\" name=\"options\"/>\n"
 "      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
 "    </method>\n"
+"    <method name=\"MntTranslateBatch\">\n"
+"      <annotation value=\"QVariantMap\" name=\"org.qtproject.QtDBus.QtTypeName.In3\"/>\n"
+"      <arg direction=\"in\" type=\"as\" name=\"texts\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"lang\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"out_lang\"/>\n"
+"      <arg direction=\"in\" type=\"a{sv}\" name=\"options\"/>\n"
+"      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
+"    </method>\n"
+"    <method name=\"MntTranslateFd\">\n"
+"      <annotation value=\"QVariantMap\" name=\"org.qtproject.QtDBus.QtTypeName.In3\"/>\n"
+"      <arg direction=\"in\" type=\"h\" name=\"text\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"lang\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"out_lang\"/>\n"
+"      <arg direction=\"in\" type=\"a{sv}\" name=\"options\"/>\n"
+"      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
+"    </method>\n"
 "    <method name=\"MntGetOutLangs\">\n"
 "      <annotation value=\"QVariantMap\" name=\"org.qtproject.QtDBus.QtTypeName.Out0\"/>\n"
 "      <arg direction=\"in\" type=\"s\" name=\"lang\"/>\n"
@@ -206,6 +238,21 @@ class SpeechAdaptor: public QDBusAbstractAdaptor
 "      <arg direction=\"in\" type=\"s\" name=\"out_lang\"/>\n"
 "      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
 "    </method>\n"
+"    <method name=\"SttStartListen2\">\n"
+"      <annotation value=\"QVariantMap\" name=\"org.qtproject.QtDBus.QtTypeName.In3\"/>\n"
+"      <arg direction=\"in\" type=\"i\" name=\"mode\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"lang\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"out_lang\"/>\n"
+"      <arg direction=\"in\" type=\"a{sv}\" name=\"options\"/>\n"
+"      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
+"    </method>\n"
+"    <method name=\"SttStartInterpret\">\n"
+"      <annotation value=\"QVariantMap\" name=\"org.qtproject.QtDBus.QtTypeName.In2\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"lang\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"out_lang\"/>\n"
+"      <arg direction=\"in\" type=\"a{sv}\" name=\"options\"/>\n"
+"      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
+"    </method>\n"
 "    <method name=\"SttStopListen\">\n"
 "      <arg direction=\"in\" type=\"i\" name=\"task\"/>\n"
 "      <arg direction=\"out\" type=\"i\" name=\"result\"/>\n"
@@ -216,6 +263,14 @@ class SpeechAdaptor: public QDBusAbstractAdaptor
 "      <arg direction=\"in\" type=\"s\" name=\"out_lang\"/>\n"
 "      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
 "    </method>\n"
+"    <method name=\"SttTranscribeFile2\">\n"
+"      <annotation value=\"QVariantMap\" name=\"org.qtproject.QtDBus.QtTypeName.In3\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"file\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"lang\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"out_lang\"/>\n"
+"      <arg direction=\"in\" type=\"a{sv}\" name=\"options\"/>\n"
+"      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
+"    </method>\n"
 "    <method name=\"TtsPlaySpeech\">\n"
 "      <arg direction=\"in\" type=\"s\" name=\"text\"/>\n"
 "      <arg direction=\"in\" type=\"s\" name=\"lang\"/>\n"
@@ -228,6 +283,13 @@ class SpeechAdaptor: public QDBusAbstractAdaptor
 "      <arg direction=\"in\" type=\"a{sv}\" name=\"options\"/>\n"
 "      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
 "    </method>\n"
+"    <method name=\"TtsPrerenderSpeech\">\n"
+"      <annotation value=\"QVariantMap\" name=\"org.qtproject.QtDBus.QtTypeName.In2\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"text\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"lang\"/>\n"
+"      <arg direction=\"in\" type=\"a{sv}\" name=\"options\"/>\n"
+"      <arg direction=\"out\" type=\"i\" name=\"result\"/>\n"
+"    </method>\n"
 "    <method name=\"TtsStopSpeech\">\n"
 "      <arg direction=\"in\" type=\"i\" name=\"task\"/>\n"
 "      <arg direction=\"out\" type=\"i\" name=\"result\"/>\n"
@@ -239,6 +301,20 @@ class SpeechAdaptor: public QDBusAbstractAdaptor
 "      <arg direction=\"in\" type=\"a{sv}\" name=\"options\"/>\n"
 "      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
 "    </method>\n"
+"    <method name=\"TtsPlaySpeechFd\">\n"
+"      <annotation value=\"QVariantMap\" name=\"org.qtproject.QtDBus.QtTypeName.In2\"/>\n"
+"      <arg direction=\"in\" type=\"h\" name=\"text\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"lang\"/>\n"
+"      <arg direction=\"in\" type=\"a{sv}\" name=\"options\"/>\n"
+"      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
+"    </method>\n"
+"    <method name=\"TtsSpeechToFileFd\">\n"
+"      <annotation value=\"QVariantMap\" name=\"org.qtproject.QtDBus.QtTypeName.In2\"/>\n"
+"      <arg direction=\"in\" type=\"h\" name=\"text\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"lang\"/>\n"
+"      <arg direction=\"in\" type=\"a{sv}\" name=\"options\"/>\n"
+"      <arg direction=\"out\" type=\"i\" name=\"task\"/>\n"
+"    </method>\n"
 "    <method name=\"TtsPauseSpeech\">\n"
 "      <arg direction=\"in\" type=\"i\" name=\"task\"/>\n"
 "      <arg direction=\"out\" type=\"i\" name=\"result\"/>\n"
@@ -323,6 +399,10 @@ public: // PROPERTIES
     Q_PROPERTY(QVariantMap MntLangs READ mntLangs)
     QVariantMap mntLangs() const;
 
+    Q_PROPERTY(int PerformanceProfile READ performanceProfile WRITE setPerformanceProfile)
+    int performanceProfile() const;
+    void setPerformanceProfile(int value);
+
     Q_PROPERTY(int State READ state)
     int state() const;
 
@@ -367,17 +447,25 @@ public Q_SLOTS: // METHODS
     QVariantMap MntGetOutLangs(const QString &lang);
     int MntTranslate(const QString &text, const QString &lang, const QString &out_lang);
     int MntTranslate2(const QString &text, const QString &lang, const QString &out_lang, const QVariantMap &options);
+    int MntTranslateBatch(const QStringList &texts, const QString &lang, const QString &out_lang, const QVariantMap &options);
+    int MntTranslateFd(const QDBusUnixFileDescriptor &text, const QString &lang, const QString &out_lang, const QVariantMap &options);
     int Reload();
     double SttGetFileTranscribeProgress(int task);
     int SttStartListen(int mode, const QString &lang, const QString &out_lang);
+    int SttStartListen2(int mode, const QString &lang, const QString &out_lang, const QVariantMap &options);
+    int SttStartInterpret(const QString &lang, const QString &out_lang, const QVariantMap &options);
     int SttStopListen(int task);
     int SttTranscribeFile(const QString &file, const QString &lang, const QString &out_lang);
+    int SttTranscribeFile2(const QString &file, const QString &lang, const QString &out_lang, const QVariantMap &options);
     double TtsGetSpeechToFileProgress(int task);
     int TtsPauseSpeech(int task);
     int TtsPlaySpeech(const QString &text, const QString &lang);
     int TtsPlaySpeech2(const QString &text, const QString &lang, const QVariantMap &options);
+    int TtsPlaySpeechFd(const QDBusUnixFileDescriptor &text, const QString &lang, const QVariantMap &options);
+    int TtsPrerenderSpeech(const QString &text, const QString &lang, const QVariantMap &options);
     int TtsResumeSpeech(int task);
     int TtsSpeechToFile(const QString &text, const QString &lang, const QVariantMap &options);
+    int TtsSpeechToFileFd(const QDBusUnixFileDescriptor &text, const QString &lang, const QVariantMap &options);
     int TtsStopSpeech(int task);
 Q_SIGNALS: // SIGNALS
     void CurrentTaskPropertyChanged(int task);
@@ -392,6 +480,9 @@ Q_SIGNALS: // SIGNALS
     void MntLangListChanged(const QVariantList &langs);
     void MntLangsPropertyChanged(const QVariantMap &langs);
     void MntTranslateFinished(const QString &in_text, const QString &in_lang, const QString &out_text, const QString &out_lang, int task);
+    void MntTranslateBatchFinished(const QString &in_lang, const QStringList &out_texts, const QString &out_lang, int task);
+    void MntTranslateFdFinished(const QDBusUnixFileDescriptor &out_text, const QString &in_lang, const QString &out_lang, int task);
+    void PerformanceProfilePropertyChanged(int profile);
     void StatePropertyChanged(int state);
     void SttFileTranscribeFinished(int task);
     void SttFileTranscribeProgress(double progress, int task);
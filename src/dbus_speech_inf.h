@@ -83,6 +83,12 @@ public:
     inline QVariantMap mntLangs() const
     { return qvariant_cast< QVariantMap >(property("MntLangs")); }
 
+    Q_PROPERTY(int PerformanceProfile READ performanceProfile WRITE setPerformanceProfile)
+    inline int performanceProfile() const
+    { return qvariant_cast< int >(property("PerformanceProfile")); }
+    inline void setPerformanceProfile(int value)
+    { setProperty("PerformanceProfile", QVariant::fromValue(value)); }
+
     Q_PROPERTY(int State READ state)
     inline int state() const
     { return qvariant_cast< int >(property("State")); }
@@ -179,6 +185,20 @@ public Q_SLOTS: // METHODS
         return asyncCallWithArgumentList(QStringLiteral("MntTranslate2"), argumentList);
     }
 
+    inline QDBusPendingReply<int> MntTranslateBatch(const QStringList &texts, const QString &lang, const QString &out_lang, const QVariantMap &options)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(texts) << QVariant::fromValue(lang) << QVariant::fromValue(out_lang) << QVariant::fromValue(options);
+        return asyncCallWithArgumentList(QStringLiteral("MntTranslateBatch"), argumentList);
+    }
+
+    inline QDBusPendingReply<int> MntTranslateFd(const QDBusUnixFileDescriptor &text, const QString &lang, const QString &out_lang, const QVariantMap &options)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(text) << QVariant::fromValue(lang) << QVariant::fromValue(out_lang) << QVariant::fromValue(options);
+        return asyncCallWithArgumentList(QStringLiteral("MntTranslateFd"), argumentList);
+    }
+
     inline QDBusPendingReply<int> Reload()
     {
         QList<QVariant> argumentList;
@@ -199,6 +219,20 @@ public Q_SLOTS: // METHODS
         return asyncCallWithArgumentList(QStringLiteral("SttStartListen"), argumentList);
     }
 
+    inline QDBusPendingReply<int> SttStartListen2(int mode, const QString &lang, const QString &out_lang, const QVariantMap &options)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(mode) << QVariant::fromValue(lang) << QVariant::fromValue(out_lang) << QVariant::fromValue(options);
+        return asyncCallWithArgumentList(QStringLiteral("SttStartListen2"), argumentList);
+    }
+
+    inline QDBusPendingReply<int> SttStartInterpret(const QString &lang, const QString &out_lang, const QVariantMap &options)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(lang) << QVariant::fromValue(out_lang) << QVariant::fromValue(options);
+        return asyncCallWithArgumentList(QStringLiteral("SttStartInterpret"), argumentList);
+    }
+
     inline QDBusPendingReply<int> SttStopListen(int task)
     {
         QList<QVariant> argumentList;
@@ -213,6 +247,13 @@ public Q_SLOTS: // METHODS
         return asyncCallWithArgumentList(QStringLiteral("SttTranscribeFile"), argumentList);
     }
 
+    inline QDBusPendingReply<int> SttTranscribeFile2(const QString &file, const QString &lang, const QString &out_lang, const QVariantMap &options)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(file) << QVariant::fromValue(lang) << QVariant::fromValue(out_lang) << QVariant::fromValue(options);
+        return asyncCallWithArgumentList(QStringLiteral("SttTranscribeFile2"), argumentList);
+    }
+
     inline QDBusPendingReply<double> TtsGetSpeechToFileProgress(int task)
     {
         QList<QVariant> argumentList;
@@ -241,6 +282,20 @@ public Q_SLOTS: // METHODS
         return asyncCallWithArgumentList(QStringLiteral("TtsPlaySpeech2"), argumentList);
     }
 
+    inline QDBusPendingReply<int> TtsPlaySpeechFd(const QDBusUnixFileDescriptor &text, const QString &lang, const QVariantMap &options)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(text) << QVariant::fromValue(lang) << QVariant::fromValue(options);
+        return asyncCallWithArgumentList(QStringLiteral("TtsPlaySpeechFd"), argumentList);
+    }
+
+    inline QDBusPendingReply<int> TtsPrerenderSpeech(const QString &text, const QString &lang, const QVariantMap &options)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(text) << QVariant::fromValue(lang) << QVariant::fromValue(options);
+        return asyncCallWithArgumentList(QStringLiteral("TtsPrerenderSpeech"), argumentList);
+    }
+
     inline QDBusPendingReply<int> TtsResumeSpeech(int task)
     {
         QList<QVariant> argumentList;
@@ -255,6 +310,13 @@ public Q_SLOTS: // METHODS
         return asyncCallWithArgumentList(QStringLiteral("TtsSpeechToFile"), argumentList);
     }
 
+    inline QDBusPendingReply<int> TtsSpeechToFileFd(const QDBusUnixFileDescriptor &text, const QString &lang, const QVariantMap &options)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(text) << QVariant::fromValue(lang) << QVariant::fromValue(options);
+        return asyncCallWithArgumentList(QStringLiteral("TtsSpeechToFileFd"), argumentList);
+    }
+
     inline QDBusPendingReply<int> TtsStopSpeech(int task)
     {
         QList<QVariant> argumentList;
@@ -275,6 +337,9 @@ Q_SIGNALS: // SIGNALS
     void MntLangListChanged(const QVariantList &langs);
     void MntLangsPropertyChanged(const QVariantMap &langs);
     void MntTranslateFinished(const QString &in_text, const QString &in_lang, const QString &out_text, const QString &out_lang, int task);
+    void MntTranslateBatchFinished(const QString &in_lang, const QStringList &out_texts, const QString &out_lang, int task);
+    void MntTranslateFdFinished(const QDBusUnixFileDescriptor &out_text, const QString &in_lang, const QString &out_lang, int task);
+    void PerformanceProfilePropertyChanged(int profile);
     void StatePropertyChanged(int state);
     void SttFileTranscribeFinished(int task);
     void SttFileTranscribeProgress(double progress, int task);
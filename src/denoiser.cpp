@@ -11,26 +11,113 @@ extern "C" {
 #include <rnnoise-nu.h>
 }
 
+#include <dlfcn.h>
+
 #include <algorithm>
 #include <cmath>
 #include <stdexcept>
 
+#include "cpu_tools.hpp"
 #include "logger.hpp"
 
+struct rnnoise_api {
+    decltype(&::rnnoise_get_model) rnnoise_get_model = nullptr;
+    decltype(&::rnnoise_create) rnnoise_create = nullptr;
+    decltype(&::rnnoise_destroy) rnnoise_destroy = nullptr;
+    decltype(&::rnnoise_set_param) rnnoise_set_param = nullptr;
+    decltype(&::rnnoise_process_frame) rnnoise_process_frame = nullptr;
+    inline auto ok() const {
+        return rnnoise_get_model && rnnoise_create && rnnoise_destroy &&
+               rnnoise_set_param && rnnoise_process_frame;
+    }
+};
+
+static void* open_rnnoise_lib() {
+    void* handle = nullptr;
+
+#ifdef ARCH_ARM_32
+    if (cpu_tools::neon_supported()) {
+        LOGD("using rnnoise-nu-neon");
+        handle = dlopen("librnnoise-nu-neon.so", RTLD_LAZY);
+    }
+#elif ARCH_X86_64
+    if (cpu_tools::avx_avx2_fma_f16c_supported()) {
+        LOGD("using rnnoise-nu-avx2");
+        handle = dlopen("librnnoise-nu-avx2.so", RTLD_LAZY);
+    }
+#endif
+
+    if (handle == nullptr) {
+        LOGD("using rnnoise-nu-fallback");
+        handle = dlopen("librnnoise-nu-fallback.so", RTLD_LAZY);
+    }
+
+    if (handle == nullptr) {
+        // not bundled rnnoise (BUILD_RNNOISE=OFF)
+        LOGD("using rnnoise-nu");
+        handle = dlopen("librnnoise-nu.so", RTLD_LAZY);
+    }
+
+    return handle;
+}
+
+// lib is opened once and never closed
+static const rnnoise_api& rnnoise() {
+    static const auto api = [] {
+        rnnoise_api api;
+
+        auto* handle = open_rnnoise_lib();
+        if (handle == nullptr) {
+            LOGE("failed to open rnnoise lib: " << dlerror());
+            return api;
+        }
+
+        api.rnnoise_get_model =
+            reinterpret_cast<decltype(api.rnnoise_get_model)>(
+                dlsym(handle, "rnnoise_get_model"));
+        api.rnnoise_create = reinterpret_cast<decltype(api.rnnoise_create)>(
+            dlsym(handle, "rnnoise_create"));
+        api.rnnoise_destroy = reinterpret_cast<decltype(api.rnnoise_destroy)>(
+            dlsym(handle, "rnnoise_destroy"));
+        api.rnnoise_set_param =
+            reinterpret_cast<decltype(api.rnnoise_set_param)>(
+                dlsym(handle, "rnnoise_set_param"));
+        api.rnnoise_process_frame =
+            reinterpret_cast<decltype(api.rnnoise_process_frame)>(
+                dlsym(handle, "rnnoise_process_frame"));
+
+        if (!api.ok()) {
+            LOGE("failed to register rnnoise api");
+            dlclose(handle);
+            return rnnoise_api{};
+        }
+
+        return api;
+    }();
+
+    return api;
+}
+
 denoiser::denoiser(int sample_rate) {
-    auto* model = rnnoise_get_model("orig");
+    const auto& api = rnnoise();
+    if (!api.ok()) {
+        LOGE("denoising is disabled");
+        return;
+    }
+
+    auto* model = api.rnnoise_get_model("orig");
     if (model == nullptr) LOGE("rnnoise model not found");
 
-    m_state = rnnoise_create(model);
+    m_state = api.rnnoise_create(model);
     if (m_state == nullptr)
         throw std::runtime_error("failed to create rnnoise");
 
-    rnnoise_set_param(m_state, RNNOISE_PARAM_MAX_ATTENUATION, 10.0);
-    rnnoise_set_param(m_state, RNNOISE_PARAM_SAMPLE_RATE, sample_rate);
+    api.rnnoise_set_param(m_state, RNNOISE_PARAM_MAX_ATTENUATION, 10.0);
+    api.rnnoise_set_param(m_state, RNNOISE_PARAM_SAMPLE_RATE, sample_rate);
 }
 
 denoiser::~denoiser() {
-    if (m_state) rnnoise_destroy(m_state);
+    if (m_state) rnnoise().rnnoise_destroy(m_state);
     m_state = nullptr;
 }
 
@@ -75,6 +162,13 @@ void denoiser::process_char(char* buf, size_t size) {
 }
 
 void denoiser::process(sample_t* buf, size_t size) {
+    const auto& api = rnnoise();
+
+    if (m_state == nullptr) {
+        normalize_audio(buf, size);
+        return;
+    }
+
     frame_t frame;
 
     auto* cur = buf;
@@ -91,7 +185,8 @@ void denoiser::process(sample_t* buf, size_t size) {
             for (size_t i = 0; i < frame.size() - samples; ++i) frame[i] = 0.0;
         }
 
-        auto prob = rnnoise_process_frame(m_state, frame.data(), frame.data());
+        auto prob =
+            api.rnnoise_process_frame(m_state, frame.data(), frame.data());
 
         LOGT("prob: " << prob);
 
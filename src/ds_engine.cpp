@@ -157,10 +157,9 @@ stt_engine::samples_process_result_t ds_engine::process_buff() {
         m_decoded_samples = 0;
     }
 
-    m_denoiser.process(m_in_buf.buf.data(), m_in_buf.size);
+    denoise_in_buf();
 
-    const auto& vad_buf =
-        m_vad.remove_silence(m_in_buf.buf.data(), m_in_buf.size);
+    const auto& vad_buf = remove_silence_from_in_buf();
 
     m_in_buf.clear();
 
@@ -278,7 +277,7 @@ void ds_engine::decode_speech(const ds_buf_t& buf, bool eof) {
     LOGD("speech decoded");
 #endif
 
-    if (m_punctuator) result = m_punctuator->process(result);
+    if (m_punctuator) result = m_punctuator->process_incremental(result);
 
     if (!m_intermediate_text || m_intermediate_text != result)
         set_intermediate_text(result);
@@ -9,6 +9,7 @@
 
 #include <QClipboard>
 #include <QDBusConnection>
+#include <QDBusUnixFileDescriptor>
 #include <QDebug>
 #include <QDir>
 #include <QFile>
@@ -20,6 +21,7 @@
 #include <utility>
 
 #include "downloader.hpp"
+#include "fd_tools.hpp"
 #include "media_compressor.hpp"
 #include "mtag_tools.hpp"
 #include "speech_service.h"
@@ -252,6 +254,12 @@ dsnote_app::dsnote_app(QObject *parent)
     connect(&m_translator_delay_timer, &QTimer::timeout, this,
             &dsnote_app::handle_translate_delayed, Qt::QueuedConnection);
 
+    // note is prerendered when the user stops typing for a while
+    m_tts_prerender_delay_timer.setSingleShot(true);
+    m_tts_prerender_delay_timer.setInterval(2000);
+    connect(&m_tts_prerender_delay_timer, &QTimer::timeout, this,
+            &dsnote_app::handle_tts_prerender_delayed, Qt::QueuedConnection);
+
     m_open_files_delay_timer.setSingleShot(true);
     m_open_files_delay_timer.setInterval(500);
     connect(&m_open_files_delay_timer, &QTimer::timeout, this,
@@ -370,6 +378,9 @@ void dsnote_app::request_reload() {
         qDebug() << "[app => dbus] Reload";
     }
 
+    // service reads settings from file
+    settings::instance()->flush();
+
     auto reply = m_dbus_service.Reload();
     reply.waitForFinished();
 
@@ -413,6 +424,25 @@ void dsnote_app::handle_stt_intermediate_text(const QString &text,
     }
 }
 
+// texts longer than this are passed to the service in memfd
+static const int large_text_size = 100000;
+
+static std::optional<QDBusUnixFileDescriptor> large_text_fd(
+    const QString &text) {
+    if (text.size() < large_text_size) return std::nullopt;
+
+    auto fd = fd_tools::make_text_fd(text.toStdString());
+    if (fd < 0) {
+        qWarning() << "failed to make text fd";
+        return std::nullopt;
+    }
+
+    QDBusUnixFileDescriptor text_fd;
+    text_fd.giveFileDescriptor(fd);
+
+    return text_fd;
+}
+
 static std::pair<QChar, QString> full_stop(const QString &lang) {
     if (lang.startsWith("zh") || lang.startsWith("ja"))
         return {u'\U00003002', ""};
@@ -721,6 +751,27 @@ void dsnote_app::connect_service_signals() {
                 &dsnote_app::handle_tts_speech_to_file_progress);
         connect(&m_dbus_service, &OrgMkiolSpeechInterface::MntTranslateFinished,
                 this, &dsnote_app::handle_mnt_translate_finished);
+        connect(&m_dbus_service,
+                &OrgMkiolSpeechInterface::MntTranslateFdFinished, this,
+                [this](const QDBusUnixFileDescriptor &out_text,
+                       const QString &in_lang, const QString &out_lang,
+                       int task) {
+                    qDebug() << "[dbus => app] signal MntTranslateFdFinished:"
+                             << task;
+
+                    auto text =
+                        out_text.isValid()
+                            ? fd_tools::read_text(out_text.fileDescriptor())
+                            : std::nullopt;
+                    if (!text) {
+                        qWarning() << "failed to read translated text from fd";
+                        return;
+                    }
+
+                    handle_mnt_translate_finished(
+                        {}, in_lang, QString::fromStdString(*text), out_lang,
+                        task);
+                });
         connect(&m_dbus_service,
                 &OrgMkiolSpeechInterface::FeaturesAvailabilityUpdated, this,
                 [this] {
@@ -1811,7 +1862,7 @@ void dsnote_app::transcribe_file(const QString &source_file, bool replace) {
     if (s->launch_mode() == settings::launch_mode_t::app_stanalone) {
         new_task = speech_service::instance()->stt_transcribe_file(
             source_file, {},
-            s->whisper_translate() ? QStringLiteral("en") : QString{});
+            s->whisper_translate() ? QStringLiteral("en") : QString{}, {});
     } else {
         qDebug() << "[app => dbus] call SttTranscribeFile";
 
@@ -1850,7 +1901,7 @@ void dsnote_app::listen_internal() {
     if (s->launch_mode() == settings::launch_mode_t::app_stanalone) {
         new_task = speech_service::instance()->stt_start_listen(
             static_cast<speech_service::speech_mode_t>(s->speech_mode()), {},
-            s->whisper_translate() ? QStringLiteral("en") : QString{});
+            s->whisper_translate() ? QStringLiteral("en") : QString{}, {});
     } else {
         qDebug() << "[app => dbus] call SttStartListen:" << s->speech_mode();
         new_task = m_dbus_service.SttStartListen(
@@ -1947,9 +1998,16 @@ void dsnote_app::play_speech_internal(const QString &text,
         new_task = speech_service::instance()->tts_play_speech(text, model_id,
                                                                options);
     } else {
-        qDebug() << "[app => dbus] call TtsPlaySpeech";
+        if (auto text_fd = large_text_fd(text)) {
+            qDebug() << "[app => dbus] call TtsPlaySpeechFd";
 
-        new_task = m_dbus_service.TtsPlaySpeech2(text, model_id, options);
+            new_task =
+                m_dbus_service.TtsPlaySpeechFd(*text_fd, model_id, options);
+        } else {
+            qDebug() << "[app => dbus] call TtsPlaySpeech";
+
+            new_task = m_dbus_service.TtsPlaySpeech2(text, model_id, options);
+        }
     }
 
     m_primary_task.set(new_task);
@@ -1958,6 +2016,34 @@ void dsnote_app::play_speech_internal(const QString &text,
     emit intermediate_text_changed();
 }
 
+void dsnote_app::handle_tts_prerender_delayed() {
+    if (service_state() != service_state_t::StateIdle || note().isEmpty())
+        return;
+
+    QVariantMap options;
+    options.insert("speech_speed", settings::instance()->speech_speed());
+
+    auto ref_voice =
+        tts_ref_voice_needed() ? active_tts_ref_voice() : QString{};
+    if (m_available_tts_ref_voices_map.contains(ref_voice)) {
+        auto l = m_available_tts_ref_voices_map.value(ref_voice).toStringList();
+        if (l.size() > 1) options.insert("ref_voice_file", l.at(1));
+    }
+
+    // only beginning of the note is prerendered, so large text is cut
+    // instead of passing it in fd
+    auto text = note().left(large_text_size);
+
+    if (settings::instance()->launch_mode() ==
+        settings::launch_mode_t::app_stanalone) {
+        speech_service::instance()->tts_prerender_speech(text, {}, options);
+    } else {
+        qDebug() << "[app => dbus] call TtsPrerenderSpeech";
+
+        m_dbus_service.TtsPrerenderSpeech(text, {}, options);
+    }
+}
+
 void dsnote_app::play_speech() {
     play_speech_internal(
         note(), {},
@@ -2026,10 +2112,18 @@ void dsnote_app::translate() {
             new_task = speech_service::instance()->mnt_translate(
                 note(), m_active_mnt_lang, m_active_mnt_out_lang, options);
         } else {
-            qDebug() << "[app => dbus] call MntTranslate";
+            if (auto text_fd = large_text_fd(note())) {
+                qDebug() << "[app => dbus] call MntTranslateFd";
 
-            new_task = m_dbus_service.MntTranslate2(
-                note(), m_active_mnt_lang, m_active_mnt_out_lang, options);
+                new_task = m_dbus_service.MntTranslateFd(
+                    *text_fd, m_active_mnt_lang, m_active_mnt_out_lang,
+                    options);
+            } else {
+                qDebug() << "[app => dbus] call MntTranslate";
+
+                new_task = m_dbus_service.MntTranslate2(
+                    note(), m_active_mnt_lang, m_active_mnt_out_lang, options);
+            }
         }
 
         m_primary_task.set(new_task);
@@ -2151,9 +2245,16 @@ void dsnote_app::speech_to_file_internal(const QString &text,
         new_task = speech_service::instance()->tts_speech_to_file(
             text, model_id, options);
     } else {
-        qDebug() << "[app => dbus] call TtsSpeechToFile";
+        if (auto text_fd = large_text_fd(text)) {
+            qDebug() << "[app => dbus] call TtsSpeechToFileFd";
+
+            new_task =
+                m_dbus_service.TtsSpeechToFileFd(*text_fd, model_id, options);
+        } else {
+            qDebug() << "[app => dbus] call TtsSpeechToFile";
 
-        new_task = m_dbus_service.TtsSpeechToFile(text, model_id, options);
+            new_task = m_dbus_service.TtsSpeechToFile(text, model_id, options);
+        }
     }
 
     m_side_task.set(new_task);
@@ -2780,6 +2881,9 @@ void dsnote_app::handle_note_changed() {
     if (settings::instance()->translator_mode() &&
         settings::instance()->translate_when_typing())
         translate_delayed();
+
+    if (settings::instance()->tts_prerender())
+        m_tts_prerender_delay_timer.start();
 }
 
 void dsnote_app::save_note_to_file(const QString &dest_file) {
@@ -464,6 +464,7 @@ class dsnote_app : public QObject {
     QTimer m_keepalive_timer;
     QTimer m_keepalive_current_task_timer;
     QTimer m_translator_delay_timer;
+    QTimer m_tts_prerender_delay_timer;
     QTimer m_open_files_delay_timer;
     QTimer m_action_delay_timer;
     QTimer m_desktop_notification_delay_timer;
@@ -646,6 +647,7 @@ class dsnote_app : public QObject {
                                     const QString &dest_file);
     void copy_to_clipboard_internal(const QString &text);
     void handle_translate_delayed();
+    void handle_tts_prerender_delayed();
     void open_next_file();
     void reset_files_queue();
     void register_hotkeys();
@@ -0,0 +1,173 @@
+/* Copyright (C) 2023 Michal Kosciesza <michal@mkiol.net>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "engine_plugin.hpp"
+
+#include <dlfcn.h>
+#include <sys/stat.h>
+
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "logger.hpp"
+
+std::ostream& operator<<(std::ostream& os, engine_plugin::plugin_t plugin) {
+    switch (plugin) {
+        case engine_plugin::plugin_t::piper:
+            os << "piper";
+            break;
+        case engine_plugin::plugin_t::espeak:
+            os << "espeak";
+            break;
+        case engine_plugin::plugin_t::rhvoice:
+            os << "rhvoice";
+            break;
+        case engine_plugin::plugin_t::april:
+            os << "april";
+            break;
+    }
+
+    return os;
+}
+
+namespace engine_plugin {
+static const size_t plugins_count = 4;
+
+struct plugin_data_t {
+    // empty when plugin is not installed, in that case it is searched in
+    // library search path (e.g. LD_LIBRARY_PATH in development build)
+    std::string path;
+    void* handle = nullptr;
+    const api_t* api = nullptr;
+};
+
+static std::array<plugin_data_t, plugins_count> plugins_data;
+static std::mutex plugins_mutex;
+static bool discovered = false;
+
+static std::string file_name(plugin_t plugin) {
+    std::ostringstream os;
+    os << "libdsnote_" << plugin << ".so";
+    return os.str();
+}
+
+static bool file_exists(const std::string& file_path) {
+    struct stat buffer {};
+    return stat(file_path.c_str(), &buffer) == 0;
+}
+
+static void discover_internal() {
+    if (discovered) return;
+
+    for (size_t i = 0; i < plugins_count; ++i) {
+        auto plugin = static_cast<plugin_t>(i);
+        auto path = std::string{PLUGINS_DIR} + "/" + file_name(plugin);
+
+        if (file_exists(path)) {
+            LOGD("engine plugin found: " << path);
+            plugins_data[i].path = std::move(path);
+        } else {
+            LOGD("engine plugin not found in " << PLUGINS_DIR << ": "
+                                               << plugin);
+        }
+    }
+
+    discovered = true;
+}
+
+void discover() {
+    std::lock_guard lock{plugins_mutex};
+    discover_internal();
+}
+
+static const api_t* load(plugin_t plugin) {
+    std::lock_guard lock{plugins_mutex};
+    discover_internal();
+
+    auto& data = plugins_data[static_cast<size_t>(plugin)];
+    if (data.api) return data.api;
+
+    auto path = data.path.empty() ? file_name(plugin) : data.path;
+
+    LOGD("loading engine plugin: " << path);
+
+    data.handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!data.handle) {
+        LOGE("failed to open engine plugin: " << dlerror());
+        throw std::runtime_error("failed to open engine plugin");
+    }
+
+    auto entry = reinterpret_cast<const api_t* (*)()>(
+        dlsym(data.handle, ENGINE_PLUGIN_ENTRY_NAME));
+    const auto* api = entry ? entry() : nullptr;
+
+    if (!api || !api->app_version ||
+        std::strcmp(api->app_version, APP_VERSION) != 0) {
+        LOGE("invalid engine plugin: " << path);
+        dlclose(data.handle);
+        data.handle = nullptr;
+        throw std::runtime_error("invalid engine plugin");
+    }
+
+    data.api = api;
+
+    LOGD("engine plugin loaded: " << plugin);
+
+    return data.api;
+}
+
+bool check() {
+    bool ok = true;
+
+    for (size_t i = 0; i < plugins_count; ++i) {
+        auto plugin = static_cast<plugin_t>(i);
+        try {
+            load(plugin);
+            LOGI("engine plugin ok: " << plugin);
+        } catch (const std::runtime_error& err) {
+            LOGE("engine plugin error: " << plugin << ", " << err.what());
+            ok = false;
+        }
+    }
+
+    return ok;
+}
+
+std::unique_ptr<tts_engine> make_tts_engine(
+    plugin_t plugin, tts_engine::config_t config,
+    tts_engine::callbacks_t call_backs) {
+    const auto* api = load(plugin);
+    if (!api->make_tts_engine)
+        throw std::runtime_error("plugin doesn't provide tts engine");
+
+    return std::unique_ptr<tts_engine>{
+        api->make_tts_engine(std::move(config), std::move(call_backs))};
+}
+
+std::unique_ptr<stt_engine> make_stt_engine(
+    plugin_t plugin, stt_engine::config_t config,
+    stt_engine::callbacks_t call_backs) {
+    const auto* api = load(plugin);
+    if (!api->make_stt_engine)
+        throw std::runtime_error("plugin doesn't provide stt engine");
+
+    return std::unique_ptr<stt_engine>{
+        api->make_stt_engine(std::move(config), std::move(call_backs))};
+}
+
+bool engine_of_plugin(plugin_t plugin, const std::type_info& type) {
+    std::lock_guard lock{plugins_mutex};
+
+    const auto* api = plugins_data[static_cast<size_t>(plugin)].api;
+
+    return api && *api->engine_type == type;
+}
+}  // namespace engine_plugin
@@ -0,0 +1,86 @@
+/* Copyright (C) 2023 Michal Kosciesza <michal@mkiol.net>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ENGINE_PLUGIN_HPP
+#define ENGINE_PLUGIN_HPP
+
+#include <iostream>
+#include <memory>
+#include <typeinfo>
+
+#include "config.h"
+#include "stt_engine.hpp"
+#include "tts_engine.hpp"
+
+// Engines with large dependencies are built as shared-object plugins
+// (libdsnote_<name>.so). Plugins are discovered at startup, but plugin is
+// loaded only when its engine is created for the first time. Loaded plugin
+// is never unloaded.
+namespace engine_plugin {
+enum class plugin_t { piper, espeak, rhvoice, april };
+
+struct api_t {
+    // plugin must be built together with the app
+    const char* app_version = nullptr;
+    const std::type_info* engine_type = nullptr;
+    tts_engine* (*make_tts_engine)(tts_engine::config_t config,
+                                   tts_engine::callbacks_t call_backs) =
+        nullptr;
+    stt_engine* (*make_stt_engine)(stt_engine::config_t config,
+                                   stt_engine::callbacks_t call_backs) =
+        nullptr;
+};
+
+void discover();
+// loads all plugins, returns false when any plugin can't be loaded
+bool check();
+// throws std::runtime_error when plugin can't be loaded
+std::unique_ptr<tts_engine> make_tts_engine(plugin_t plugin,
+                                            tts_engine::config_t config,
+                                            tts_engine::callbacks_t call_backs);
+std::unique_ptr<stt_engine> make_stt_engine(plugin_t plugin,
+                                            stt_engine::config_t config,
+                                            stt_engine::callbacks_t call_backs);
+// doesn't load the plugin, engine can't be created by plugin which is not
+// loaded yet
+bool engine_of_plugin(plugin_t plugin, const std::type_info& type);
+}  // namespace engine_plugin
+
+std::ostream& operator<<(std::ostream& os, engine_plugin::plugin_t plugin);
+
+#define ENGINE_PLUGIN_ENTRY_NAME "dsnote_engine_plugin_api"
+
+// defines entry point of plugin, use once in plugin's source file
+#define ENGINE_PLUGIN_TTS(engine_class)                                    \
+    extern "C" __attribute__((visibility("default"))) const                \
+        engine_plugin::api_t*                                              \
+        dsnote_engine_plugin_api() {                                       \
+        static const engine_plugin::api_t api{                             \
+            APP_VERSION, &typeid(engine_class),                            \
+            [](tts_engine::config_t config,                                \
+               tts_engine::callbacks_t call_backs) -> tts_engine* {        \
+                return new engine_class{std::move(config),                 \
+                                        std::move(call_backs)};            \
+            },                                                             \
+            nullptr};                                                      \
+        return &api;                                                       \
+    }
+#define ENGINE_PLUGIN_STT(engine_class)                                    \
+    extern "C" __attribute__((visibility("default"))) const                \
+        engine_plugin::api_t*                                              \
+        dsnote_engine_plugin_api() {                                       \
+        static const engine_plugin::api_t api{                             \
+            APP_VERSION, &typeid(engine_class), nullptr,                   \
+            [](stt_engine::config_t config,                                \
+               stt_engine::callbacks_t call_backs) -> stt_engine* {        \
+                return new engine_class{std::move(config),                 \
+                                        std::move(call_backs)};            \
+            }};                                                            \
+        return &api;                                                       \
+    }
+
+#endif // ENGINE_PLUGIN_HPP
@@ -14,6 +14,7 @@
 #include <cstdlib>
 #include <fstream>
 
+#include "engine_plugin.hpp"
 #include "logger.hpp"
 
 espeak_engine::espeak_engine(config_t config, callbacks_t call_backs)
@@ -157,3 +158,5 @@ bool espeak_engine::encode_speech_impl(const std::string& text,
 
     return true;
 }
+
+ENGINE_PLUGIN_TTS(espeak_engine)
@@ -139,7 +139,7 @@ fake_keyboard::fake_keyboard(QObject *parent)
             &fake_keyboard::send_keyevent, Qt::QueuedConnection);
 
     m_delay_timer.setSingleShot(false);
-    m_delay_timer.setInterval(10);  // send key event every 10ms
+    m_delay_timer.setInterval(delay_msec);  // send batch of key events
 
     connect(&m_delay_timer, &QTimer::timeout, this,
             &fake_keyboard::send_keyevent, Qt::QueuedConnection);
@@ -170,21 +170,25 @@ void fake_keyboard::send_keyevent() {
         return;
     }
 
-    auto event = create_key_event(
-        m_x11_display, m_focus_window, m_root_window,
-        key_from_character(m_x11_display, m_xkb_keymap, m_num_layouts,
-                           m_text.at(m_text_cursor).unicode()));
-    event.type = KeyPress;
-    XSendEvent(event.display, event.window, True, KeyPressMask,
-               reinterpret_cast<XEvent *>(&event));
+    // Key events for whole batch of characters are sent with only one
+    // XSync. XSync only confirms that server received events, not that
+    // target application processed them, so batch size is fixed and small.
 
-    XSync(event.display, False);
+    auto end_cursor = std::min(m_text_cursor + batch_size, m_text.size());
 
-    event.type = KeyRelease;
-    XSendEvent(event.display, event.window, True, KeyReleaseMask,
-               reinterpret_cast<XEvent *>(&event));
+    for (; m_text_cursor < end_cursor; ++m_text_cursor) {
+        auto event = create_key_event(
+            m_x11_display, m_focus_window, m_root_window,
+            key_from_character(m_x11_display, m_xkb_keymap, m_num_layouts,
+                               m_text.at(m_text_cursor).unicode()));
+        event.type = KeyPress;
+        XSendEvent(event.display, event.window, True, KeyPressMask,
+                   reinterpret_cast<XEvent *>(&event));
 
-    XSync(event.display, False);
+        event.type = KeyRelease;
+        XSendEvent(event.display, event.window, True, KeyReleaseMask,
+                   reinterpret_cast<XEvent *>(&event));
+    }
 
-    ++m_text_cursor;
+    XSync(m_x11_display, False);
 }
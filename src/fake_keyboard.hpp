@@ -31,6 +31,10 @@ class fake_keyboard : public QObject {
     void send_keyevent_request();
 
    private:
+    // 800 chars/s cap, 500 chars are typed in ~0.6s
+    static constexpr int batch_size = 8;
+    static constexpr int delay_msec = 10;
+
     Display* m_x11_display = nullptr;
     xcb_connection_t* m_xcb_conn = nullptr;
     xkb_context* m_xkb_ctx = nullptr;
@@ -43,6 +43,7 @@ void fasterwhisper_engine::stop() {
         try {
             pe->execute([&]() {
                   try {
+                      m_batched_model.reset();
                       m_model.reset();
                   } catch (const std::exception& err) {
                       LOGE("py error: " << err.what());
@@ -66,7 +67,10 @@ void fasterwhisper_engine::push_buf_to_whisper_buf(
                    });
 }
 
-void fasterwhisper_engine::reset_impl() { m_speech_buf.clear(); }
+void fasterwhisper_engine::reset_impl() {
+    m_speech_buf.clear();
+    m_batch.clear();
+}
 
 void fasterwhisper_engine::stop_processing_impl() {
     LOGD("fasterwhisper cancel");
@@ -87,7 +91,9 @@ void fasterwhisper_engine::create_model() {
     try {
         ok = pe->execute([&]() {
                    auto n_threads = std::min(
-                       m_threads,
+                       m_config.num_threads > 0
+                           ? static_cast<int>(m_config.num_threads)
+                           : m_threads,
                        std::max(1, static_cast<int>(
                                        std::thread::hardware_concurrency())));
                    auto use_cuda = m_config.use_gpu &&
@@ -148,10 +154,9 @@ stt_engine::samples_process_result_t fasterwhisper_engine::process_buff() {
         m_vad.reset();
     }
 
-    m_denoiser.process(m_in_buf.buf.data(), m_in_buf.size);
+    denoise_in_buf();
 
-    const auto& vad_buf =
-        m_vad.remove_silence(m_in_buf.buf.data(), m_in_buf.size);
+    const auto& vad_buf = remove_silence_from_in_buf();
 
     m_in_buf.clear();
 
@@ -208,6 +213,11 @@ stt_engine::samples_process_result_t fasterwhisper_engine::process_buff() {
         if (eof || (m_config.speech_mode == speech_mode_t::manual &&
                     m_speech_detection_status ==
                         speech_detection_status_t::no_speech)) {
+            if (eof && !m_batch.empty()) {
+                set_processing_state(processing_state_t::decoding);
+                flush_batch();
+                set_processing_state(processing_state_t::idle);
+            }
             flush(eof ? flush_t::eof : flush_t::regular);
             free_buf();
             return samples_process_result_t::no_samples_needed;
@@ -230,7 +240,25 @@ stt_engine::samples_process_result_t fasterwhisper_engine::process_buff() {
 
     LOGD("speech frame: samples=" << m_speech_buf.size());
 
-    decode_speech(m_speech_buf);
+    // when transcribing file, utterances are collected and decoded in
+    // batches, so text is delivered later but throughput is much higher
+    if (m_config.file_source &&
+        m_config.speech_mode == speech_mode_t::automatic &&
+        !m_batched_model_failed) {
+        m_batch.push_back(std::move(m_speech_buf));
+        m_speech_buf.clear();
+        m_speech_buf.reserve(m_speech_max_size);
+
+        if (m_batch.size() < m_batch_size && !eof) {
+            set_processing_state(processing_state_t::idle);
+            free_buf();
+            return samples_process_result_t::wait_for_samples;
+        }
+
+        flush_batch();
+    } else {
+        decode_speech(m_speech_buf);
+    }
 
     set_processing_state(processing_state_t::idle);
 
@@ -251,6 +279,203 @@ stt_engine::samples_process_result_t fasterwhisper_engine::process_buff() {
     return samples_process_result_t::wait_for_samples;
 }
 
+bool fasterwhisper_engine::create_batched_model() {
+    if (m_batched_model) return true;
+    if (m_batched_model_failed) return false;
+
+    create_model();
+
+    LOGD("creating fasterwhisper batched model");
+
+    auto* pe = py_executor::instance();
+
+    try {
+        m_batched_model_failed =
+            pe->execute([&]() {
+                  try {
+                      auto fw = py::module_::import("faster_whisper");
+
+                      // batched pipeline is available in faster-whisper 1.1
+                      // and newer
+                      if (!py::hasattr(fw, "BatchedInferencePipeline")) {
+                          LOGW("fasterwhisper batched inference not "
+                               "supported");
+                          return std::string{"false"};
+                      }
+
+                      m_batched_model.emplace(fw.attr(
+                          "BatchedInferencePipeline")("model"_a = *m_model));
+                  } catch (const std::exception& err) {
+                      LOGE("py error: " << err.what());
+                      m_batched_model.reset();
+                      return std::string{"false"};
+                  }
+                  return std::string{"true"};
+              }).get() != "true";
+    } catch (const std::exception& err) {
+        LOGE("failed to create fasterwhisper batched model: " << err.what());
+        m_batched_model_failed = true;
+    }
+
+    return !m_batched_model_failed;
+}
+
+void fasterwhisper_engine::flush_batch() {
+    auto batch = std::move(m_batch);
+    m_batch.clear();
+
+    auto texts = decode_batch(batch);
+
+    if (m_thread_exit_requested) return;
+
+    if (!texts) {
+        LOGD("decoding batch sequentially");
+
+        for (auto it = batch.cbegin(); it != batch.cend(); ++it) {
+            if (it != batch.cbegin()) flush(flush_t::regular);
+            decode_speech(*it);
+            if (m_thread_exit_requested) return;
+        }
+
+        return;
+    }
+
+    // each utterance is delivered as separate text, the last one is
+    // flushed by the caller
+    for (auto it = texts->cbegin(); it != texts->cend(); ++it) {
+        if (it != texts->cbegin()) flush(flush_t::regular);
+        if (!it->empty())
+            set_intermediate_text(merge_texts(
+                m_intermediate_text.value_or(std::string{}), *it));
+    }
+}
+
+std::optional<std::vector<std::string>> fasterwhisper_engine::decode_batch(
+    const std::vector<whisper_buf_t>& batch) {
+    if (!create_batched_model()) return std::nullopt;
+
+    LOGD("batch decoding started: utterances=" << batch.size());
+
+    auto decoding_start = std::chrono::steady_clock::now();
+
+    // utterances are joined into one audio and clip timestamps are set at
+    // utterance boundaries, clip cannot be longer than 30s
+    struct clip_t {
+        size_t start = 0;
+        size_t end = 0;
+        size_t utterance = 0;
+    };
+
+    std::vector<clip_t> clips;
+    size_t audio_size = 0;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        for (size_t pos = 0; pos < batch[i].size(); pos += m_clip_max_size) {
+            clips.push_back({audio_size + pos,
+                             audio_size + std::min(pos + m_clip_max_size,
+                                                   batch[i].size()),
+                             i});
+        }
+        audio_size += batch[i].size();
+    }
+
+    auto params = make_decoding_params(m_config.decoding_profile);
+
+    std::vector<std::string> texts(batch.size());
+
+    auto* pe = py_executor::instance();
+
+    try {
+        auto ok =
+            pe->execute([&]() {
+                  try {
+                      py::array_t<float> array(audio_size);
+                      auto r = array.mutable_unchecked<1>();
+                      py::ssize_t idx = 0;
+                      for (const auto& buf : batch)
+                          for (auto sample : buf) r(idx++) = sample;
+
+                      py::list clip_timestamps;
+                      for (const auto& clip : clips) {
+                          py::dict ts;
+                          ts["start"] = static_cast<double>(clip.start) /
+                                        m_sample_rate;
+                          ts["end"] =
+                              static_cast<double>(clip.end) / m_sample_rate;
+                          clip_timestamps.append(ts);
+                      }
+
+                      auto seg_tuple = m_batched_model->attr("transcribe")(
+                          "audio"_a = array,
+                          "batch_size"_a = m_batch_size,
+                          "beam_size"_a = params.beam_size,
+                          "clip_timestamps"_a = clip_timestamps,
+                          "vad_filter"_a = false,
+                          "without_timestamps"_a = true,
+                          "language"_a = m_config.lang,
+                          "task"_a = m_config.translate ? "translate"
+                                                        : "transcribe");
+
+                      auto segments = *seg_tuple.cast<py::list>().begin();
+
+                      // segments are mapped back to utterances by
+                      // start time
+                      for (auto& segment : segments) {
+                          auto text = segment.attr("text").cast<std::string>();
+
+                          rtrim(text);
+                          ltrim(text);
+
+                          if (text.empty()) continue;
+
+                          auto start = static_cast<size_t>(
+                              segment.attr("start").cast<double>() *
+                              m_sample_rate);
+                          auto it = std::upper_bound(
+                              clips.cbegin(), clips.cend(), start,
+                              [](size_t value, const clip_t& clip) {
+                                  return value < clip.start;
+                              });
+                          if (it != clips.cbegin()) --it;
+#ifdef DEBUG
+                          LOGD("segment: utterance=" << it->utterance
+                                                     << ", text=" << text);
+#endif
+                          auto& utterance_text = texts.at(it->utterance);
+                          if (!utterance_text.empty()) utterance_text += ' ';
+                          utterance_text += text;
+                      }
+
+                      return std::string{"true"};
+                  } catch (const std::exception& err) {
+                      LOGE("fasterwhisper py error: " << err.what());
+                      return std::string{"false"};
+                  }
+              }).get() == "true";
+
+        if (!ok) {
+            m_batched_model_failed = true;
+            return std::nullopt;
+        }
+    } catch (const std::exception& err) {
+        LOGE("fasterwhisper error: " << err.what());
+        m_batched_model_failed = true;
+        return std::nullopt;
+    }
+
+    auto decoding_dur = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now() - decoding_start)
+                            .count();
+
+    LOGD("batch decoded, stats: utterances="
+         << batch.size() << ", samples=" << audio_size
+         << ", duration=" << decoding_dur << "ms ("
+         << static_cast<double>(decoding_dur) /
+                ((1000 * audio_size) / static_cast<double>(m_sample_rate))
+         << ")");
+
+    return texts;
+}
+
 void fasterwhisper_engine::decode_speech(const whisper_buf_t& buf) {
     LOGD("speech decoding started");
 
@@ -260,6 +485,11 @@ void fasterwhisper_engine::decode_speech(const whisper_buf_t& buf) {
 
     auto* pe = py_executor::instance();
 
+    auto params = make_decoding_params(m_config.decoding_profile);
+
+    LOGD("decoding profile: " << m_config.decoding_profile << " [" << params
+                              << "]");
+
     std::string text;
 
     try {
@@ -270,8 +500,19 @@ void fasterwhisper_engine::decode_speech(const whisper_buf_t& buf) {
                          for (py::ssize_t i = 0; i < r.shape(0); ++i)
                              r(i) = buf[i];
 
+                         // single temperature disables fallback
+                         py::object temperature =
+                             params.temperature_fallback
+                                 ? py::object{py::make_tuple(0.0, 0.2, 0.4,
+                                                             0.6, 0.8, 1.0)}
+                                 : py::object{py::float_(0.0)};
+
                          auto seg_tuple = m_model->attr("transcribe")(
-                             "audio"_a = array, "beam_size"_a = 5,
+                             "audio"_a = array,
+                             "beam_size"_a = params.beam_size,
+                             "temperature"_a = temperature,
+                             "condition_on_previous_text"_a =
+                                 params.use_context,
                              "language"_a = m_config.lang,
                              "task"_a = m_config.translate ? "translate"
                                                            : "transcribe");
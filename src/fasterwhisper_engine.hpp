@@ -30,15 +30,24 @@ class fasterwhisper_engine : public stt_engine {
     using whisper_buf_t = std::vector<float>;
 
     inline static const size_t m_speech_max_size = m_sample_rate * 60;  // 60s
+    inline static const size_t m_clip_max_size = m_sample_rate * 30;    // 30s
+    inline static const size_t m_batch_size = 8;
     inline static const int m_threads = 8;
 
     std::optional<py::object> m_model;
+    std::optional<py::object> m_batched_model;
+    bool m_batched_model_failed = false;
 
     whisper_buf_t m_speech_buf;
+    std::vector<whisper_buf_t> m_batch;
 
     void create_model();
+    bool create_batched_model();
     samples_process_result_t process_buff() override;
     void decode_speech(const whisper_buf_t& buf);
+    std::optional<std::vector<std::string>> decode_batch(
+        const std::vector<whisper_buf_t>& batch);
+    void flush_batch();
     static void push_buf_to_whisper_buf(
         const std::vector<in_buf_t::buf_t::value_type>& buf,
         whisper_buf_t& whisper_buf);
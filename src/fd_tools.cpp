@@ -0,0 +1,110 @@
+/* Copyright (C) 2023 Michal Kosciesza <michal@mkiol.net>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "fd_tools.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+
+namespace fd_tools {
+static bool shrink_sealed(int fd) {
+#ifdef F_GET_SEALS
+    auto seals = fcntl(fd, F_GET_SEALS);
+    return seals >= 0 && (seals & F_SEAL_SHRINK) != 0;
+#else
+    static_cast<void>(fd);
+    return false;
+#endif
+}
+
+static std::optional<std::string> read_text_mapped(int fd, size_t size) {
+    auto* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) return std::nullopt;
+
+    std::string text{static_cast<const char*>(data), size};
+
+    munmap(data, size);
+
+    return text;
+}
+
+std::optional<std::string> read_text(int fd, size_t max_size) {
+    struct stat st {};
+    if (fstat(fd, &st) != 0) return std::nullopt;
+
+    if (!S_ISREG(st.st_mode)) return std::nullopt;
+
+    std::string text;
+
+    auto size = static_cast<size_t>(st.st_size);
+    if (size > max_size) return std::nullopt;
+    if (size == 0) return text;
+
+    // mapping is safe only when the sender can't truncate the file,
+    // otherwise reading past new end would raise SIGBUS
+    if (shrink_sealed(fd)) {
+        if (auto mapped = read_text_mapped(fd, size)) return mapped;
+    }
+
+    text.reserve(size);
+
+    // file is not sealed, so it can still grow while reading
+    std::array<char, 65536> buf;
+    off_t offset = 0;
+
+    while (true) {
+        auto size = pread(fd, buf.data(), buf.size(), offset);
+        if (size < 0) {
+            if (errno == EINTR) continue;
+            return std::nullopt;
+        }
+        if (size == 0) break;
+        if (text.size() + static_cast<size_t>(size) > max_size)
+            return std::nullopt;
+
+        text.append(buf.data(), static_cast<size_t>(size));
+        offset += size;
+    }
+
+    return text;
+}
+
+int make_text_fd(const std::string& text) {
+#ifdef MFD_ALLOW_SEALING
+    auto fd = memfd_create("dsnote-text", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0) return -1;
+
+    size_t written = 0;
+    while (written < text.size()) {
+        auto size = write(fd, text.data() + written, text.size() - written);
+        if (size < 0) {
+            if (errno == EINTR) continue;
+            close(fd);
+            return -1;
+        }
+        written += static_cast<size_t>(size);
+    }
+
+    if (fcntl(fd, F_ADD_SEALS,
+              F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0 ||
+        lseek(fd, 0, SEEK_SET) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+#else
+    static_cast<void>(text);
+    return -1;
+#endif
+}
+}  // namespace fd_tools
@@ -0,0 +1,27 @@
+/* Copyright (C) 2023 Michal Kosciesza <michal@mkiol.net>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef FD_TOOLS_HPP
+#define FD_TOOLS_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace fd_tools {
+inline constexpr size_t default_max_text_size = 64 * 1024 * 1024;
+
+// reads whole content of memfd or regular file, pipes and other fd types are
+// rejected because reading could block forever, returns nullopt on error or
+// when text is larger than max_size
+std::optional<std::string> read_text(
+    int fd, size_t max_size = default_max_text_size);
+// returns sealed memfd with text or -1 on error, caller owns returned fd
+int make_text_fd(const std::string& text);
+}  // namespace fd_tools
+
+#endif  // FD_TOOLS_HPP
@@ -8,6 +8,7 @@
 #include "itemmodel.h"
 
 #include <QDebug>
+#include <QHash>
 #include <algorithm>
 
 ItemWorker::ItemWorker(ItemModel *model, const QString &data)
@@ -55,18 +56,35 @@ size_t ItemModel::firstChangedItemIdx(
 void ItemModel::updateItem([[maybe_unused]] ListItem *oldItem,
                            [[maybe_unused]] const ListItem *newItem) {}
 
-void ItemModel::workerDone() {
-    auto oldCount = getCount();
-
-    auto *worker = qobject_cast<ItemWorker *>(sender());
+// Items that exist in both lists are kept and updated in place, only removed
+// and added items are reported to the view. Works when items that exist in
+// both lists have the same relative order, otherwise all items after the first
+// mismatch are replaced.
+void ItemModel::applyItems(const QList<ListItem *> &newItems) {
+    QHash<QString, int> new_ids;
+    new_ids.reserve(newItems.size());
+    for (int i = 0; i < newItems.size(); ++i)
+        new_ids.insert(newItems.at(i)->id(), i);
+
+    bool same_order = true;
+    int last_new_idx = -1;
+    for (const auto *item : qAsConst(m_list)) {
+        auto it = new_ids.constFind(item->id());
+        if (it == new_ids.cend()) continue;
+        if (it.value() <= last_new_idx) {
+            same_order = false;
+            break;
+        }
+        last_new_idx = it.value();
+    }
 
-    if (worker) {
-        auto min_size = std::min(m_list.size(), worker->items.size());
+    if (!same_order) {
+        auto min_size = std::min(m_list.size(), newItems.size());
 
         int updated_count = 0;
         for (; updated_count < min_size; ++updated_count) {
             auto *old_item = readRow(updated_count);
-            auto *new_item = worker->items.at(updated_count);
+            auto *new_item = newItems.at(updated_count);
 
             if (old_item->id() != new_item->id()) break;
 
@@ -77,9 +95,59 @@ void ItemModel::workerDone() {
         if (updated_count < m_list.size())
             removeRows(updated_count, m_list.size() - updated_count);
 
-        if (updated_count < worker->items.size())
-            appendRows(worker->items.mid(updated_count));
+        if (updated_count < newItems.size())
+            appendRows(newItems.mid(updated_count));
+
+        return;
+    }
+
+    // remove items not present in new list (contiguous ranges from the end)
+    for (int row = m_list.size() - 1; row >= 0;) {
+        if (new_ids.contains(m_list.at(row)->id())) {
+            --row;
+            continue;
+        }
+
+        int first = row;
+        while (first > 0 && !new_ids.contains(m_list.at(first - 1)->id()))
+            --first;
+
+        removeRows(first, row - first + 1);
+        row = first - 1;
+    }
+
+    // update existing items and insert missing ones
+    int row = 0;
+    for (int i = 0; i < newItems.size();) {
+        auto *new_item = newItems.at(i);
+
+        if (row < m_list.size() && m_list.at(row)->id() == new_item->id()) {
+            updateItem(m_list.at(row), new_item);
+            delete new_item;
+            ++row;
+            ++i;
+            continue;
+        }
+
+        int last = i + 1;
+        while (last < newItems.size() &&
+               (row >= m_list.size() ||
+                m_list.at(row)->id() != newItems.at(last)->id()))
+            ++last;
+
+        insertRows(row, newItems.mid(i, last - i));
+        row += last - i;
+        i = last;
+    }
+}
+
+void ItemModel::workerDone() {
+    auto oldCount = getCount();
 
+    auto *worker = qobject_cast<ItemWorker *>(sender());
+
+    if (worker) {
+        applyItems(worker->items);
         m_worker.reset(nullptr);
     }
 
@@ -62,6 +62,7 @@ class ItemModel : public ListModel {
                                        const QList<ListItem *> &newItems);
     virtual void updateItem(ListItem *oldItem, const ListItem *newItem);
     void setBusy(bool busy);
+    void applyItems(const QList<ListItem *> &newItems);
 
    protected slots:
     virtual void workerDone();
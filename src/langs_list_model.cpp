@@ -10,12 +10,17 @@
 #include <QDebug>
 #include <QList>
 #include <algorithm>
+#include <iterator>
 
 LangsListModel::LangsListModel(QObject *parent)
     : SelectableItemModel{new LangsListItem, parent} {
     connect(
         models_manager::instance(), &models_manager::models_changed, this,
-        [this] { updateModel(); }, Qt::QueuedConnection);
+        [this] {
+            m_langsDirty = true;
+            updateModel();
+        },
+        Qt::QueuedConnection);
     connect(
         this, &ItemModel::busyChanged, this,
         [this] {
@@ -63,26 +68,40 @@ ListItem *LangsListModel::makeItem(const models_manager::lang_t &lang) {
         /*downloading=*/lang.downloading};
 }
 
+void LangsListModel::updateLangs() {
+    m_catalog = models_manager::instance()->catalog();
+
+    const auto &langs = m_catalog->langs;
+
+    m_searchKeys.clear();
+    m_searchKeys.reserve(langs.size());
+    std::transform(langs.cbegin(), langs.cend(),
+                   std::back_inserter(m_searchKeys), [](const auto &lang) {
+                       return QStringLiteral("%1\n%2\n%3")
+                           .arg(lang.name, lang.id, lang.name_en)
+                           .toLower();
+                   });
+}
+
 QList<ListItem *> LangsListModel::makeItems() {
     QList<ListItem *> items;
 
-    auto langs = models_manager::instance()->langs();
+    if (m_langsDirty.exchange(false)) updateLangs();
+
+    const auto &langs = m_catalog->langs;
 
     updateDownloading(langs);
 
-    auto phase = getFilter();
+    auto phase = getFilter().toLower();
 
     if (phase.isEmpty()) {
         std::transform(langs.cbegin(), langs.cend(), std::back_inserter(items),
                        [&](const auto &lang) { return makeItem(lang); });
     } else {
-        std::for_each(langs.cbegin(), langs.cend(), [&](const auto &lang) {
-            if (lang.name.contains(phase, Qt::CaseInsensitive) ||
-                lang.id.contains(phase, Qt::CaseInsensitive) ||
-                lang.name_en.contains(phase, Qt::CaseInsensitive)) {
-                items.push_back(makeItem(lang));
-            }
-        });
+        for (size_t i = 0; i < langs.size(); ++i) {
+            if (m_searchKeys[i].contains(phase))
+                items.push_back(makeItem(langs[i]));
+        }
     }
 
     return items;
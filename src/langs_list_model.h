@@ -16,7 +16,9 @@
 #include <QUrl>
 #include <QVariant>
 #include <QVariantList>
+#include <atomic>
 #include <optional>
+#include <vector>
 
 #include "itemmodel.h"
 #include "listmodel.h"
@@ -36,6 +38,9 @@ class LangsListModel : public SelectableItemModel {
    private:
     int m_changedItem = -1;
     bool m_downloading = false;
+    std::atomic_bool m_langsDirty = true;
+    models_manager::catalog_ptr m_catalog;
+    std::vector<QString> m_searchKeys;
 
     QList<ListItem *> makeItems() override;
     static ListItem *makeItem(const models_manager::lang_t &lang);
@@ -44,6 +49,7 @@ class LangsListModel : public SelectableItemModel {
     void updateItem(ListItem *oldItem, const ListItem *newItem) override;
     inline bool downloading() const { return m_downloading; }
     void updateDownloading(const std::vector<models_manager::lang_t> &langs);
+    void updateLangs();
 };
 
 class LangsListItem : public SelectableItem {
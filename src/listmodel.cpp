@@ -67,6 +67,17 @@ void ListModel::insertRow(int row, ListItem *item) {
     endInsertRows();
 }
 
+void ListModel::insertRows(int row, const QList<ListItem *> &items) {
+    if (items.isEmpty()) return;
+    beginInsertRows(QModelIndex(), row, row + items.size() - 1);
+    for (int i = 0; i < items.size(); ++i) {
+        connect(items.at(i), SIGNAL(itemDataChanged()),
+                SLOT(handleItemChange()));
+        m_list.insert(row + i, items.at(i));
+    }
+    endInsertRows();
+}
+
 void ListModel::moveRow(int orig, int dest, const QModelIndex &parent) {
     beginMoveRows(parent, orig, orig, parent, dest);
     m_list.move(orig, dest);
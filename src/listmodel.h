@@ -39,6 +39,7 @@ class ListModel : public QAbstractListModel {
     void appendRow(ListItem* item);
     void appendRows(const QList<ListItem*>& items);
     void insertRow(int row, ListItem* item);
+    void insertRows(int row, const QList<ListItem*>& items);
     bool removeRow(int row, const QModelIndex& parent = QModelIndex());
     bool removeRows(int row, int count,
                     const QModelIndex& parent = QModelIndex());
@@ -14,11 +14,15 @@
 #include <QLocale>
 #include <QObject>
 #include <QQmlContext>
+#include <QSocketNotifier>
 #include <QString>
 #include <QStringList>
 #include <QTextCodec>
 #include <QTranslator>
 #include <QUrl>
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <csignal>
 #include <cstdlib>
 #include <memory>
@@ -47,6 +51,7 @@
 #include "avlogger.hpp"
 #include "config.h"
 #include "dsnote_app.h"
+#include "engine_plugin.hpp"
 #include "logger.hpp"
 #include "models_list_model.h"
 #include "qtlogger.hpp"
@@ -57,16 +62,42 @@
 static void exit_program() {
     qDebug() << "exiting";
 
+    settings::instance()->flush();
+
     speech_service::remove_cached_media_files();
 
     // workaround for python thread locking
     std::quick_exit(0);
 }
 
+// self-pipe, signal is handled in the event loop of the main thread
+static int signal_fds[2] = {-1, -1};
+
 static void signal_handler(int sig) {
-    qDebug() << "received signal:" << sig;
+    // only async-signal-safe calls are allowed here
+    auto sig_byte = static_cast<char>(sig);
+    [[maybe_unused]] auto ret = write(signal_fds[1], &sig_byte, 1);
+}
 
-    exit_program();
+static void install_signal_handlers() {
+    if (pipe2(signal_fds, O_CLOEXEC | O_NONBLOCK) != 0) {
+        qWarning() << "failed to create signal pipe";
+        return;
+    }
+
+    auto* notifier = new QSocketNotifier{signal_fds[0], QSocketNotifier::Read,
+                                         QCoreApplication::instance()};
+    QObject::connect(notifier, &QSocketNotifier::activated, [] {
+        char sig_byte = 0;
+        while (read(signal_fds[0], &sig_byte, 1) > 0)
+            qDebug() << "received signal:" << static_cast<int>(sig_byte);
+
+        // exit_program is called on the main thread when event loop ends
+        QCoreApplication::quit();
+    });
+
+    signal(SIGINT, signal_handler);
+    signal(SIGTERM, signal_handler);
 }
 
 struct cmd_options {
@@ -78,6 +109,7 @@ struct cmd_options {
     bool gpu_scan_off = false;
     bool py_scan_off = false;
     bool reset_models = false;
+    bool check_plugins = false;
     bool start_in_tray = false;
     QString action;
     QStringList files;
@@ -149,6 +181,12 @@ static cmd_options check_options(const QCoreApplication& app) {
             "Reset the models configuration file to default settings.")};
     parser.addOption(resetmodels_opt);
 
+    QCommandLineOption checkplugins_opt{
+        QStringLiteral("check-plugins"),
+        QStringLiteral("Loads all engine plugins and exits. Exit code is "
+                       "non-zero when any plugin can't be loaded.")};
+    parser.addOption(checkplugins_opt);
+
 #ifdef USE_DESKTOP
     QCommandLineOption start_in_tray_opt{
         QStringLiteral("start-in-tray"),
@@ -229,6 +267,7 @@ static cmd_options check_options(const QCoreApplication& app) {
     options.gpu_scan_off = parser.isSet(gpuscanoff_opt);
     options.py_scan_off = parser.isSet(pyscanoff_opt);
     options.reset_models = parser.isSet(resetmodels_opt);
+    options.check_plugins = parser.isSet(checkplugins_opt);
     options.files = parser.positionalArguments();
 #ifdef USE_DESKTOP
     options.start_in_tray = parser.isSet(start_in_tray_opt);
@@ -405,10 +444,12 @@ int main(int argc, char* argv[]) {
 
     install_translator();
 
-    signal(SIGINT, signal_handler);
+    install_signal_handlers();
 
     if (cmd_opts.reset_models) models_manager::reset_models();
 
+    if (cmd_opts.check_plugins) return engine_plugin::check() ? 0 : 1;
+
     switch (cmd_opts.launch_mode) {
         case settings::launch_mode_t::service:
             qDebug() << "starting service";
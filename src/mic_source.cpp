@@ -12,7 +12,8 @@
 
 #include "settings.h"
 
-mic_source::mic_source(QObject* parent) : audio_source{parent} {
+mic_source::mic_source(bool low_power, QObject* parent)
+    : audio_source{parent}, m_low_power{low_power} {
     qDebug() << "mic source created";
     init_audio();
     start();
@@ -118,7 +119,11 @@ void mic_source::init_audio() {
 void mic_source::start() {
     m_audio_device = m_audio_input->start();
 
-    m_timer.setInterval(200);  // 200 ms
+    // shorter read interval in low-latency mode, longer in low-power mode
+    // to wake up cpu less often
+    m_timer.setInterval(m_low_power                              ? 400
+                        : settings::instance()->stt_low_latency() ? 50
+                                                                  : 200);
     connect(&m_timer, &QTimer::timeout, this, &mic_source::handle_read_timeout);
     m_timer.start();
 }
@@ -20,7 +20,7 @@
 class mic_source : public audio_source {
     Q_OBJECT
    public:
-    explicit mic_source(QObject* parent = nullptr);
+    explicit mic_source(bool low_power = false, QObject* parent = nullptr);
     ~mic_source() override;
     bool ok() const override;
     audio_data read_audio(char* buf, size_t max_size) override;
@@ -39,6 +39,7 @@ class mic_source : public audio_source {
     bool m_sof = true;
     bool m_ended = false;
     bool m_stopped = false;
+    bool m_low_power = false;
 
     void init_audio();
     void start();
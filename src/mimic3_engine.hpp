@@ -34,6 +34,8 @@ class mimic3_engine : public tts_engine {
     void create_model() final;
     bool encode_speech_impl(const std::string& text,
                             const std::string& out_file) final;
+    // synthesis runs in py executor thread
+    bool prerender_supported() const final { return false; }
     void stop();
 };
 
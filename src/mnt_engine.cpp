@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <iterator>
 #include <numeric>
 
 #include "cpu_tools.hpp"
@@ -140,6 +141,9 @@ void mnt_engine::open_bergamot_lib() {
     m_bergamot_api_api.bergamot_api_translate =
         reinterpret_cast<decltype(m_bergamot_api_api.bergamot_api_translate)>(
             dlsym(m_bergamotlib_handle, "bergamot_api_translate"));
+    m_bergamot_api_api.bergamot_api_translate_batch = reinterpret_cast<
+        decltype(m_bergamot_api_api.bergamot_api_translate_batch)>(
+        dlsym(m_bergamotlib_handle, "bergamot_api_translate_batch"));
     m_bergamot_api_api.bergamot_api_cancel =
         reinterpret_cast<decltype(m_bergamot_api_api.bergamot_api_cancel)>(
             dlsym(m_bergamotlib_handle, "bergamot_api_cancel"));
@@ -210,7 +214,7 @@ void mnt_engine::translate(std::string text) {
 
     {
         std::lock_guard lock{m_mutex};
-        m_queue.push({std::move(text)});
+        m_queue.push({std::move(text), {}});
     }
 
     LOGD("task pushed");
@@ -218,6 +222,19 @@ void mnt_engine::translate(std::string text) {
     m_cv.notify_one();
 }
 
+void mnt_engine::translate_batch(std::vector<batch_item_t> items) {
+    if (m_shutting_down) return;
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_queue.push({{}, std::move(items)});
+    }
+
+    LOGD("batch task pushed");
+
+    m_cv.notify_one();
+}
+
 void mnt_engine::set_state(state_t new_state) {
     if (m_shutting_down) new_state = state_t::idle;
 
@@ -243,9 +260,81 @@ static text_tools::text_format_t text_fromat_from_mnt_format(
     throw std::runtime_error{"invalid text format"};
 }
 
-std::string mnt_engine::translate_internal(std::string text) {
+std::vector<std::string> mnt_engine::bergamot_translate_batch(
+    void* bergamot_ctx, std::vector<std::string> texts, bool html) {
+    std::vector<const char*> texts_ptrs;
+    texts_ptrs.reserve(texts.size());
+    std::transform(texts.cbegin(), texts.cend(), std::back_inserter(texts_ptrs),
+                   [](const auto& text) { return text.c_str(); });
+
+    auto* results = m_bergamot_api_api.bergamot_api_translate_batch(
+        bergamot_ctx, texts_ptrs.data(), texts_ptrs.size(), html);
+
+    for (size_t i = 0; i < texts.size(); ++i) texts[i].assign(results[i]);
+
+    return texts;
+}
+
+std::string mnt_engine::translate_subrip_internal(const std::string& text) {
+    auto segments = text_tools::subrip_text_to_segments(text);
+
+    // cues with tags are sent as html, so tags stay around translated words
+    struct group_t {
+        std::vector<size_t> idxs;
+        std::vector<std::string> texts;
+    };
+    group_t groups[2];
+
+    for (size_t i = 0; i < segments.size(); ++i) {
+        auto& group = groups[segments[i].markup ? 1 : 0];
+        group.idxs.push_back(i);
+        group.texts.push_back(segments[i].text);
+        prepare_text(group.texts.back(), segments[i].markup
+                                             ? text_format_t::html
+                                             : text_format_t::raw);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t g = 0; g < 2; ++g) {
+        auto& group = groups[g];
+        if (group.texts.empty()) continue;
+
+        bool html = g == 1;
+
+        try {
+            if (m_shutting_down) return {};
+            group.texts = bergamot_translate_batch(
+                m_bergamot_ctx_first, std::move(group.texts), html);
+            if (m_shutting_down) return {};
+            if (m_bergamot_ctx_second)
+                group.texts = bergamot_translate_batch(
+                    m_bergamot_ctx_second, std::move(group.texts), html);
+            if (m_shutting_down) return {};
+        } catch (const std::runtime_error& err) {
+            LOGE("translation error: " << err.what());
+            return {};
+        }
+
+        for (size_t i = 0; i < group.idxs.size(); ++i)
+            segments[group.idxs[i]].text = std::move(group.texts[i]);
+    }
+
+    auto dur = std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now() - start)
+                   .count();
+
+    LOGD("subrip translation completed, stats: duration="
+         << dur << "ms, segments=" << segments.size()
+         << ", markup-segments=" << groups[1].idxs.size());
+
+    return text_tools::segments_to_subrip_text(segments);
+}
+
+void mnt_engine::prepare_text(std::string& text,
+                              text_format_t text_format) const {
     if (m_config.clean_text) {
-        switch (m_config.text_format) {
+        switch (text_format) {
             case text_format_t::raw:
                 text_tools::trim_lines(text);
                 text_tools::remove_hyphen_word_break(text);
@@ -263,7 +352,7 @@ std::string mnt_engine::translate_internal(std::string text) {
         }
     }
 
-    switch (m_config.text_format) {
+    switch (text_format) {
         case text_format_t::raw:
         case text_format_t::html:
             break;
@@ -272,10 +361,31 @@ std::string mnt_engine::translate_internal(std::string text) {
                 text, text_tools::text_format_t::markdown);
             break;
         case text_format_t::subrip:
-            text_tools::convert_text_format_to_html(
-                text, text_tools::text_format_t::subrip);
             break;
     }
+}
+
+void mnt_engine::restore_text(std::string& text, text_format_t text_format) {
+    switch (text_format) {
+        case text_format_t::raw:
+        case text_format_t::html:
+            break;
+        case text_format_t::markdown:
+            text_tools::convert_text_format_from_html(
+                text, text_fromat_from_mnt_format(text_format));
+            break;
+        case text_format_t::subrip:
+            break;
+    }
+}
+
+std::string mnt_engine::translate_internal(std::string text) {
+    // subtitles are translated cue by cue in one batch, timestamps are kept
+    // as they are
+    if (m_config.text_format == text_format_t::subrip)
+        return translate_subrip_internal(text);
+
+    prepare_text(text, m_config.text_format);
 
     bool html = m_config.text_format != text_format_t::raw;
 
@@ -300,20 +410,81 @@ std::string mnt_engine::translate_internal(std::string text) {
 
     LOGD("translation completed, stats: duration=" << dur << "ms");
 
-    switch (m_config.text_format) {
-        case text_format_t::raw:
-        case text_format_t::html:
-            break;
-        case text_format_t::markdown:
-        case text_format_t::subrip:
-            text_tools::convert_text_format_from_html(
-                text, text_fromat_from_mnt_format(m_config.text_format));
-            break;
-    }
+    restore_text(text, m_config.text_format);
 
     return text;
 }
 
+std::optional<std::vector<std::string>> mnt_engine::translate_batch_internal(
+    std::vector<batch_item_t> items) {
+    std::vector<std::string> out_texts(items.size());
+
+    // bergamot takes one html flag per call, so plain and markup texts
+    // are sent as two batches
+    struct group_t {
+        std::vector<size_t> idxs;
+        std::vector<std::string> texts;
+    };
+    group_t groups[2];
+
+    for (size_t i = 0; i < items.size(); ++i) {
+        auto& item = items[i];
+        auto format = item.text_format.value_or(m_config.text_format);
+
+        if (format == text_format_t::subrip) {
+            out_texts[i] = translate_subrip_internal(item.text);
+            if (m_shutting_down) return {};
+            continue;
+        }
+
+        prepare_text(item.text, format);
+
+        auto& group = groups[format == text_format_t::raw ? 0 : 1];
+        group.idxs.push_back(i);
+        group.texts.push_back(std::move(item.text));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t g = 0; g < 2; ++g) {
+        auto& group = groups[g];
+        if (group.texts.empty()) continue;
+
+        bool html = g == 1;
+
+        try {
+            if (m_shutting_down) return {};
+            group.texts = bergamot_translate_batch(
+                m_bergamot_ctx_first, std::move(group.texts), html);
+            if (m_shutting_down) return {};
+            if (m_bergamot_ctx_second)
+                group.texts = bergamot_translate_batch(
+                    m_bergamot_ctx_second, std::move(group.texts), html);
+            if (m_shutting_down) return {};
+        } catch (const std::runtime_error& err) {
+            LOGE("batch translation error: " << err.what());
+            return std::nullopt;
+        }
+
+        for (size_t i = 0; i < group.idxs.size(); ++i) {
+            auto idx = group.idxs[i];
+            auto format =
+                items[idx].text_format.value_or(m_config.text_format);
+            restore_text(group.texts[i], format);
+            out_texts[idx] = std::move(group.texts[i]);
+        }
+    }
+
+    auto dur = std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now() - start)
+                   .count();
+
+    LOGD("batch translation completed, stats: duration="
+         << dur << "ms, items=" << items.size());
+
+    return out_texts;
+}
+
 void mnt_engine::process() {
     LOGD("mnt processing started");
 
@@ -349,6 +520,21 @@ void mnt_engine::process() {
             auto task = std::move(queue.front());
             queue.pop();
 
+            if (task.batch) {
+                auto texts = translate_batch_internal(std::move(*task.batch));
+
+                if (m_shutting_down) break;
+
+                if (!texts) {
+                    if (m_call_backs.error) m_call_backs.error();
+                    continue;
+                }
+
+                m_call_backs.texts_translated(m_config.lang, std::move(*texts),
+                                              m_config.out_lang);
+                continue;
+            }
+
             auto text = translate_internal(task.text);
 
             if (m_shutting_down) break;
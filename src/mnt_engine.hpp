@@ -45,11 +45,21 @@ class mnt_engine {
     friend std::ostream& operator<<(std::ostream& os,
                                     const model_files_t& model_files);
 
+    struct batch_item_t {
+        std::string text;
+        // when not set, text format from config is used
+        std::optional<text_format_t> text_format;
+    };
+
     struct callbacks_t {
         std::function<void(const std::string& in_text,
                            const std::string& in_lang, std::string&& out_text,
                            const std::string& out_lang)>
             text_translated;
+        std::function<void(const std::string& in_lang,
+                           std::vector<std::string>&& out_texts,
+                           const std::string& out_lang)>
+            texts_translated;
         std::function<void(state_t state)> state_changed;
         std::function<void()> error;
     };
@@ -57,7 +67,6 @@ class mnt_engine {
     struct config_t {
         std::string lang;
         model_files_t model_files;
-        std::string nb_data;
         std::string out_lang;
         text_format_t text_format = text_format_t::raw;
         std::string options;
@@ -79,10 +88,12 @@ class mnt_engine {
     inline void set_clean_text(bool value) { m_config.clean_text = value; }
     inline auto state() const { return m_state; }
     void translate(std::string text);
+    void translate_batch(std::vector<batch_item_t> items);
 
    private:
     struct task_t {
         std::string text;
+        std::optional<std::vector<batch_item_t>> batch;
     };
 
     struct bergamot_api_api {
@@ -95,10 +106,16 @@ class mnt_engine {
         void (*bergamot_api_delete)(void* handle) = nullptr;
         const char* (*bergamot_api_translate)(void* handle, const char* text,
                                               bool text_is_html) = nullptr;
+        const char** (*bergamot_api_translate_batch)(void* handle,
+                                                     const char** texts,
+                                                     size_t size,
+                                                     bool text_is_html) =
+            nullptr;
         void (*bergamot_api_cancel)(void* handle) = nullptr;
         inline auto ok() const {
             return bergamot_api_make && bergamot_api_delete &&
-                   bergamot_api_translate && bergamot_api_cancel;
+                   bergamot_api_translate && bergamot_api_translate_batch &&
+                   bergamot_api_cancel;
         }
     };
 
@@ -123,6 +140,14 @@ class mnt_engine {
     void set_state(state_t new_state);
     void process();
     std::string translate_internal(std::string text);
+    std::string translate_subrip_internal(const std::string& text);
+    // returns nullopt when any item can't be translated
+    std::optional<std::vector<std::string>> translate_batch_internal(
+        std::vector<batch_item_t> items);
+    std::vector<std::string> bergamot_translate_batch(
+        void* bergamot_ctx, std::vector<std::string> texts, bool html);
+    void prepare_text(std::string& text, text_format_t text_format) const;
+    static void restore_text(std::string& text, text_format_t text_format);
     void open_bergamot_lib();
 };
 
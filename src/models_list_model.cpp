@@ -11,6 +11,8 @@
 #include <QList>
 #include <algorithm>
 #include <array>
+#include <iterator>
+#include <numeric>
 
 static int range_mask(int start_mask, int end_mask) {
     int mask = 0;
@@ -27,10 +29,17 @@ ModelsListModel::ModelsListModel(QObject *parent)
     : SelectableItemModel{new ModelsListItem, parent} {
     connect(
         models_manager::instance(), &models_manager::models_changed, this,
-        [this] { updateModel(); }, Qt::QueuedConnection);
+        [this] {
+            m_modelsDirty = true;
+            updateModel();
+        },
+        Qt::QueuedConnection);
     connect(
         models_manager::instance(), &models_manager::download_started, this,
-        [this]([[maybe_unused]] const QString &id) { updateModel(); },
+        [this]([[maybe_unused]] const QString &id) {
+            m_modelsDirty = true;
+            updateModel();
+        },
         Qt::QueuedConnection);
     connect(
         this, &ItemModel::busyChanged, this,
@@ -232,14 +241,63 @@ bool ModelsListModel::defaultFilters() const {
            m_featureFilterFlags == ModelFeatureFilterFlags::FeatureDefault;
 }
 
+void ModelsListModel::updateModels() {
+    m_catalog = models_manager::instance()->catalog();
+
+    m_models.clear();
+    for (const auto &model : m_catalog->models) {
+        if (m_lang.isEmpty() || m_lang == model.lang_id)
+            m_models.push_back(&model);
+    }
+
+    m_searchKeys.clear();
+    m_searchKeys.reserve(m_models.size());
+    std::transform(m_models.cbegin(), m_models.cend(),
+                   std::back_inserter(m_searchKeys), [](const auto &model) {
+                       return QStringLiteral("%1\n%2\n%3\n%2-%3")
+                           .arg(model->name, model->lang_id,
+                                model->trg_lang_id)
+                           .toLower();
+                   });
+
+    m_lastPhase.clear();
+    m_lastMatches.clear();
+}
+
+std::vector<size_t> ModelsListModel::matchedModels(const QString &phase) {
+    std::vector<size_t> matches;
+
+    if (phase.isEmpty()) {
+        matches.resize(m_models.size());
+        std::iota(matches.begin(), matches.end(), 0);
+        return matches;
+    }
+
+    auto lphase = phase.toLower();
+
+    auto match = [&](size_t idx) {
+        if (m_searchKeys[idx].contains(lphase)) matches.push_back(idx);
+    };
+
+    // when user types next characters, only previous matches can still match
+    if (!m_lastPhase.isEmpty() && lphase.contains(m_lastPhase)) {
+        std::for_each(m_lastMatches.cbegin(), m_lastMatches.cend(), match);
+    } else {
+        for (size_t i = 0; i < m_searchKeys.size(); ++i) match(i);
+    }
+
+    m_lastPhase = lphase;
+    m_lastMatches = matches;
+
+    return matches;
+}
+
 QList<ListItem *> ModelsListModel::makeItems() {
     QList<ListItem *> items;
 
-    auto models = models_manager::instance()->models(m_lang);
+    if (m_modelsDirty.exchange(false)) updateModels();
 
-    updateDownloading(models);
-
-    auto phase = getFilter();
+    updateDownloading(m_models);
 
     int existing_not_generic_feature_flags = 0;
     auto add_not_generic_feature_flag_if_exists =
@@ -250,33 +308,17 @@ QList<ListItem *> ModelsListModel::makeItems() {
                     existing_not_generic_feature_flags |= flag;
         };
 
-    if (phase.isEmpty()) {
-        std::for_each(models.cbegin(), models.cend(), [&](const auto &model) {
-            if (roleFilterPass(model)) {
-                if (genericFeatureFilterPass(model)) {
-                    add_not_generic_feature_flag_if_exists(model.features);
-                    if (featureFilterPass(model))
-                        items.push_back(makeItem(model));
-                }
-            }
-        });
-    } else {
-        std::for_each(models.cbegin(), models.cend(), [&](const auto &model) {
-            if (roleFilterPass(model)) {
-                if (genericFeatureFilterPass(model) &&
-                    (model.name.contains(phase, Qt::CaseInsensitive) ||
-                     model.lang_id.contains(phase, Qt::CaseInsensitive) ||
-                     model.trg_lang_id.contains(phase, Qt::CaseInsensitive) ||
-                     QStringLiteral("%1-%2")
-                         .arg(model.lang_id, model.trg_lang_id)
-                         .contains(phase, Qt::CaseInsensitive))) {
-                    add_not_generic_feature_flag_if_exists(model.features);
-                    if (featureFilterPass(model))
-                        items.push_back(makeItem(model));
-                }
+    auto matches = matchedModels(getFilter());
+
+    std::for_each(matches.cbegin(), matches.cend(), [&](auto idx) {
+        const auto &model = *m_models[idx];
+        if (roleFilterPass(model)) {
+            if (genericFeatureFilterPass(model)) {
+                add_not_generic_feature_flag_if_exists(model.features);
+                if (featureFilterPass(model)) items.push_back(makeItem(model));
             }
-        });
-    }
+        }
+    });
 
     m_disabledFeatureFilterFlags = 0;
     for (int flag = ModelFeatureFilterFlags::FeatureSttStart;
@@ -293,6 +335,7 @@ QList<ListItem *> ModelsListModel::makeItems() {
 void ModelsListModel::setLang(const QString &lang) {
     if (lang != m_lang) {
         m_lang = lang;
+        m_modelsDirty = true;
         updateModel();
         emit langChanged();
     }
@@ -334,10 +377,10 @@ void ModelsListModel::setFeatureFilterFlags(int featureFilterFlags) {
 }
 
 void ModelsListModel::updateDownloading(
-    const std::vector<models_manager::model_t> &models) {
+    const std::vector<const models_manager::model_t *> &models) {
     const bool new_downloading =
         !std::none_of(models.cbegin(), models.cend(),
-                      [](const auto &model) { return model.downloading; });
+                      [](const auto *model) { return model->downloading; });
     if (m_downloading != new_downloading) {
         m_downloading = new_downloading;
         emit downloadingChanged();
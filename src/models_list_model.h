@@ -16,7 +16,9 @@
 #include <QUrl>
 #include <QVariant>
 #include <QVariantList>
+#include <atomic>
 #include <optional>
+#include <vector>
 
 #include "itemmodel.h"
 #include "listmodel.h"
@@ -104,6 +106,13 @@ class ModelsListModel : public SelectableItemModel {
     int m_roleFilterFlags = ModelRoleFilterFlags::RoleDefault;
     int m_featureFilterFlags = ModelFeatureFilterFlags::FeatureDefault;
     int m_disabledFeatureFilterFlags = ModelFeatureFilterFlags::FeatureNone;
+    std::atomic_bool m_modelsDirty = true;
+    models_manager::catalog_ptr m_catalog;
+    // models of m_lang, owned by m_catalog
+    std::vector<const models_manager::model_t *> m_models;
+    std::vector<QString> m_searchKeys;
+    QString m_lastPhase;
+    std::vector<size_t> m_lastMatches;
 
     QList<ListItem *> makeItems() override;
     static ListItem *makeItem(const models_manager::model_t &model);
@@ -120,11 +129,14 @@ class ModelsListModel : public SelectableItemModel {
     void setLang(const QString &lang);
     void setRoleFilterFlags(int roleFilterFlags);
     void setFeatureFilterFlags(int featureFilterFlags);
-    void updateDownloading(const std::vector<models_manager::model_t> &models);
+    void updateDownloading(
+        const std::vector<const models_manager::model_t *> &models);
     bool roleFilterPass(const models_manager::model_t &model);
     bool genericFeatureFilterPass(const models_manager::model_t &model);
     bool featureFilterPass(const models_manager::model_t &model);
     bool defaultFilters() const;
+    void updateModels();
+    std::vector<size_t> matchedModels(const QString &phase);
 };
 
 class ModelsListItem : public SelectableItem {
@@ -277,6 +277,7 @@ void models_manager::set_default_model_for_lang(const QString& model_id) {
             throw std::runtime_error("invalid model role");
     }
 
+    update_catalog();
     emit models_changed();
 }
 
@@ -299,100 +300,87 @@ models_manager::available_langs_of_role_map(model_role_t role) const {
     return map;
 }
 
-std::unordered_map<QString, models_manager::lang_basic_t>
-models_manager::available_langs_map() const {
-    std::unordered_map<QString, lang_basic_t> map;
+models_manager::catalog_ptr models_manager::catalog() const {
+    return std::atomic_load(&m_catalog);
+}
 
-    std::for_each(m_langs.cbegin(), m_langs.cend(), [&](const auto& pair) {
-        if (lang_available(pair.first)) {
-            map.emplace(pair.first, lang_basic_t{
-                                        pair.first,
-                                        pair.second.first,
-                                        pair.second.second,
-                                    });
-        }
-    });
+void models_manager::update_catalog() {
+    auto catalog = std::make_shared<catalog_t>();
 
-    return map;
-}
+    QDir dir{settings::instance()->models_dir()};
 
-std::unordered_map<QString, models_manager::lang_basic_t>
-models_manager::langs_map() const {
-    std::unordered_map<QString, lang_basic_t> map;
+    std::set<QString> available_langs;
+    std::set<QString> downloading_langs;
 
-    std::for_each(m_langs.cbegin(), m_langs.cend(), [&](const auto& pair) {
-        map.emplace(pair.first, lang_basic_t{
-                                    pair.first,
-                                    pair.second.first,
-                                    pair.second.second,
-                                });
-    });
+    for (const auto& [id, model] : m_models) {
+        if (model.available) available_langs.insert(model.lang_id);
+        if (model.downloading) downloading_langs.insert(model.lang_id);
 
-    return map;
-}
+        if (model.hidden) continue;
 
-std::vector<models_manager::lang_t> models_manager::langs() const {
-    std::vector<lang_t> list;
+        auto model_file = dir.filePath(model.file_name);
 
-    std::transform(m_langs.cbegin(), m_langs.cend(), std::back_inserter(list),
-                   [this](const auto& pair) {
-                       return lang_t{
-                           pair.first,
-                           pair.second.first,
-                           pair.second.second,
-                           lang_available(pair.first),
-                           lang_downloading(pair.first),
-                       };
-                   });
+        model_t m{id,
+                  model.engine,
+                  model.lang_id,
+                  model.lang_code,
+                  model.name,
+                  model_file,
+                  sup_model_files(model.sup_models),
+                  model.speaker,
+                  model.trg_lang_id,
+                  model.score,
+                  model.options,
+                  model.license,
+                  make_download_info(model),
+                  model.default_for_lang,
+                  model.available,
+                  model.dl_multi,
+                  model.dl_off,
+                  model.features,
+                  model.downloading,
+                  model.download_progress};
+
+        if (model.available && QFile::exists(model_file))
+            catalog->available_models.push_back(m);
+
+        // file path is resolved only for available models
+        m.model_file = model.file_name;
+        catalog->models.push_back(std::move(m));
+    }
 
-    std::sort(list.begin(), list.end(), [](const auto& a, const auto& b) {
-        return QString::compare(a.id, b.id, Qt::CaseInsensitive) < 0;
-    });
+    std::sort(catalog->models.begin(), catalog->models.end(),
+              [](const auto& a, const auto& b) {
+                  auto ra = static_cast<int>(role_of_engine(a.engine));
+                  auto rb = static_cast<int>(role_of_engine(b.engine));
 
-    return list;
-}
+                  if (ra != rb) return ra < rb;
+                  if (a.score != b.score) return a.score > b.score;
+                  return QString::compare(a.id, b.id, Qt::CaseInsensitive) <
+                         0;
+              });
 
-std::vector<models_manager::model_t> models_manager::models(
-    const QString& lang_id) const {
-    std::vector<model_t> list;
+    catalog->langs.reserve(m_langs.size());
 
-    std::for_each(m_models.cbegin(), m_models.cend(), [&](const auto& pair) {
-        const auto& model = pair.second;
-        if (!model.hidden && (lang_id.isEmpty() || lang_id == model.lang_id)) {
-            list.push_back(
-                model_t{pair.first,
-                        model.engine,
-                        model.lang_id,
-                        model.lang_code,
-                        model.name,
-                        /*model_file=*/model.file_name,
-                        /*sup_files=*/sup_model_files(model.sup_models),
-                        model.speaker,
-                        model.trg_lang_id,
-                        model.score,
-                        model.options,
-                        model.license,
-                        make_download_info(model),
-                        model.default_for_lang,
-                        model.available,
-                        model.dl_multi,
-                        model.dl_off,
-                        model.features,
-                        model.downloading,
-                        model.download_progress});
-        }
-    });
+    for (const auto& [id, names] : m_langs) {
+        bool available = available_langs.count(id) != 0;
 
-    std::sort(list.begin(), list.end(), [](const auto& a, const auto& b) {
-        auto ra = static_cast<int>(role_of_engine(a.engine));
-        auto rb = static_cast<int>(role_of_engine(b.engine));
+        catalog->langs.push_back(lang_t{id, names.first, names.second,
+                                        available,
+                                        downloading_langs.count(id) != 0});
 
-        if (ra != rb) return ra < rb;
-        if (a.score != b.score) return a.score > b.score;
-        return QString::compare(a.id, b.id, Qt::CaseInsensitive) < 0;
-    });
+        lang_basic_t lang{id, names.first, names.second};
+        if (available) catalog->available_langs_map.emplace(id, lang);
+        catalog->langs_map.emplace(id, std::move(lang));
+    }
+
+    std::sort(catalog->langs.begin(), catalog->langs.end(),
+              [](const auto& a, const auto& b) {
+                  return QString::compare(a.id, b.id, Qt::CaseInsensitive) <
+                         0;
+              });
 
-    return list;
+    std::atomic_store(&m_catalog, catalog_ptr{std::move(catalog)});
 }
 
 bool models_manager::has_model_of_role(model_role_t role) const {
@@ -454,40 +442,6 @@ models_manager::download_info_t models_manager::make_download_info(
     return info;
 }
 
-std::vector<models_manager::model_t> models_manager::available_models() const {
-    std::vector<model_t> list;
-
-    QDir dir{settings::instance()->models_dir()};
-
-    for (const auto& [id, model] : m_models) {
-        auto model_file = dir.filePath(model.file_name);
-        if (!model.hidden && model.available && QFile::exists(model_file)) {
-            list.push_back({id,
-                            model.engine,
-                            model.lang_id,
-                            model.lang_code,
-                            model.name,
-                            model_file,
-                            sup_model_files(model.sup_models),
-                            model.speaker,
-                            model.trg_lang_id,
-                            model.score,
-                            model.options,
-                            model.license,
-                            make_download_info(model),
-                            model.default_for_lang,
-                            model.available,
-                            model.dl_multi,
-                            model.dl_off,
-                            model.features,
-                            model.downloading,
-                            model.download_progress});
-        }
-    }
-
-    return list;
-}
-
 bool models_manager::model_exists(const QString& id) const {
     auto it = m_models.find(id);
 
@@ -502,13 +456,6 @@ bool models_manager::lang_available(const QString& id) const {
         });
 }
 
-bool models_manager::lang_downloading(const QString& id) const {
-    return std::any_of(
-        m_models.cbegin(), m_models.cend(), [&id](const auto& model) {
-            return model.second.lang_id == id && model.second.downloading;
-        });
-}
-
 void models_manager::download_model(const QString& id) {
     download(id, download_type::all, -1, 0);
 }
@@ -587,6 +534,7 @@ void models_manager::download(const QString& id, download_type type, int part,
             update_dl_off(m_models);
 
             emit download_finished(id, true);
+            update_catalog();
             emit models_changed();
             return;
         }
@@ -739,7 +687,10 @@ void models_manager::download(const QString& id, download_type type, int part,
         emit download_started(id);
     }
 
-    if (part < 0) emit models_changed();
+    if (part < 0) {
+        update_catalog();
+        emit models_changed();
+    }
 }
 
 void models_manager::handle_ssl_errors(const QList<QSslError>& errors) {
@@ -784,6 +735,8 @@ models_manager::checksum_check_t models_manager::extract_from_archive(
         switch (comp) {
             case comp_type::tar:
                 return comp_tools::archive_type::tar;
+            case comp_type::tarxz:
+                return comp_tools::archive_type::tarxz;
             case comp_type::zip:
             case comp_type::zipall:
                 return comp_tools::archive_type::zip;
@@ -880,13 +833,10 @@ bool models_manager::handle_download(const QString& path,
                 QFile::remove(comp_file);
                 check = check_checksum(path, checksum);
             } else if (comp == comp_type::tarxz) {
-                auto tar_file = download_filename(path, comp_type::tar);
-                comp_tools::xz_decode(comp_file, tar_file);
-                QFile::remove(comp_file);
-                check = extract_from_archive(tar_file, comp_type::tar, path,
-                                             checksum, path_in_archive, path_2,
+                check = extract_from_archive(comp_file, comp, path, checksum,
+                                             path_in_archive, path_2,
                                              checksum_2, path_in_archive_2);
-                QFile::remove(tar_file);
+                QFile::remove(comp_file);
             } else if (comp == comp_type::targz) {
                 auto tar_file = download_filename(path, comp_type::tar);
                 comp_tools::gz_decode(comp_file, tar_file);
@@ -1047,6 +997,7 @@ void models_manager::handle_download_finished() {
     update_dl_multi(m_models);
     update_dl_off(m_models);
 
+    update_catalog();
     emit models_changed();
 }
 
@@ -1128,6 +1079,7 @@ void models_manager::delete_model(const QString& id) {
 
         update_dl_multi(m_models);
 
+        update_catalog();
         emit models_changed();
     } else {
         qWarning() << "no model with id:" << id;
@@ -2032,7 +1984,7 @@ void models_manager::update_dl_off(models_manager::models_t& models) {
 }
 
 void models_manager::reload() {
-    settings::instance()->sync();  // needed to update changes app -> service
+    settings::instance()->flush();  // needed to update changes app -> service
 
     if (!parse_models_file_might_reset()) m_pending_reload = true;
 }
@@ -2057,6 +2009,7 @@ bool models_manager::parse_models_file_might_reset() {
             update_models_using_availability_internal();
 
         qDebug() << "models changed";
+        update_catalog();
         emit models_changed();
         m_busy_value.store(false);
         emit busy_changed();
@@ -2340,5 +2293,6 @@ void models_manager::update_models_using_availability(
 
     update_models_using_availability_internal();
 
+    update_catalog();
     emit models_changed();
 }
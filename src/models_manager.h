@@ -16,6 +16,7 @@
 #include <QUrl>
 #include <atomic>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <set>
 #include <thread>
@@ -157,6 +158,20 @@ class models_manager : public QObject, public singleton<models_manager> {
         bool option_r = false;
     };
 
+    // Immutable snapshot of models and langs. New snapshot is published
+    // (before models_changed signal) every time models are changed, so it can
+    // be shared between readers and threads without copying.
+    struct catalog_t {
+        // not hidden models sorted by role, score and id
+        std::vector<model_t> models;
+        std::vector<model_t> available_models;
+        // sorted by id
+        std::vector<lang_t> langs;
+        std::unordered_map<QString, lang_basic_t> langs_map;
+        std::unordered_map<QString, lang_basic_t> available_langs_map;
+    };
+    using catalog_ptr = std::shared_ptr<const catalog_t>;
+
     static model_role_t role_of_engine(model_engine_t engine);
     static std::optional<std::reference_wrapper<const sup_model_file_t>>
     sup_model_file_of_role(sup_model_role_t role,
@@ -169,11 +184,7 @@ class models_manager : public QObject, public singleton<models_manager> {
     models_manager& operator=(models_manager&&) = delete;
     ~models_manager() override;
     [[nodiscard]] bool ok() const;
-    std::vector<model_t> available_models() const;
-    std::vector<model_t> models(const QString& lang_id = {}) const;
-    std::vector<lang_t> langs() const;
-    std::unordered_map<QString, lang_basic_t> langs_map() const;
-    std::unordered_map<QString, lang_basic_t> available_langs_map() const;
+    [[nodiscard]] catalog_ptr catalog() const;
     std::unordered_map<QString, lang_basic_t> available_langs_of_role_map(
         model_role_t role) const;
     [[nodiscard]] bool model_exists(const QString& id) const;
@@ -274,6 +285,7 @@ class models_manager : public QObject, public singleton<models_manager> {
     models_t m_models;
     langs_t m_langs;
     langs_of_role_t m_langs_of_role;
+    catalog_ptr m_catalog = std::make_shared<const catalog_t>();
     QNetworkAccessManager m_nam;
     std::atomic_bool m_busy_value = false;
     std::thread m_thread;
@@ -316,8 +328,8 @@ class models_manager : public QObject, public singleton<models_manager> {
     static QString download_filename(QString filename, comp_type comp,
                                      int part = -1, const QUrl& url = {});
     static bool model_sup_same_url(const priv_model_t& id, size_t sup_idx);
+    void update_catalog();
     [[nodiscard]] bool lang_available(const QString& id) const;
-    [[nodiscard]] bool lang_downloading(const QString& id) const;
     bool check_model_download_cancel(QNetworkReply* reply);
     static bool checksum_ok(const QString& checksum,
                             const QString& checksum_quick,
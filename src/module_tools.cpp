@@ -7,6 +7,7 @@
 
 #include "module_tools.hpp"
 
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <QDebug>
@@ -41,6 +42,20 @@ static QString runtime_prefix() {
     return prefix;
 }
 
+// Cheap identity of module archive. When it doesn't change, there is no need to
+// verify archive checksum.
+static QString make_module_stamp(const QString& file) {
+    struct stat st {};
+    if (stat(file.toLocal8Bit().constData(), &st) != 0) return {};
+
+    return QStringLiteral("%1:%2.%3:%4:%5")
+        .arg(st.st_size)
+        .arg(st.st_mtim.tv_sec)
+        .arg(st.st_mtim.tv_nsec)
+        .arg(st.st_ino)
+        .arg(QStringLiteral(APP_VERSION));
+}
+
 namespace module_tools {
 QString unpacked_dir(const QString& name) {
     return QStringLiteral("%1/%2").arg(
@@ -159,30 +174,20 @@ bool unpack_module(const QString& name) {
 
     auto unpack_dir =
         QStandardPaths::writableLocation(QStandardPaths::DataLocation);
-    auto unpack_file = QStringLiteral("%1/%2.tar").arg(unpack_dir, name);
 
     QDir{QStringLiteral("%1/%2").arg(unpack_dir, name)}.removeRecursively();
-    QFile::remove(unpack_file);
 
-    if (!comp_tools::xz_decode(m_file, unpack_file)) {
-        qWarning() << "failed to extract archive:" << m_file;
-        QFile::remove(unpack_file);
-        settings::instance()->set_module_checksum(name, {});
-        return false;
-    }
-
-    if (!comp_tools::archive_decode(unpack_file, comp_tools::archive_type::tar,
+    if (!comp_tools::archive_decode(m_file, comp_tools::archive_type::tarxz,
                                     {unpack_dir, {}}, false)) {
-        qWarning() << "failed to extract tar archive:" << unpack_file;
-        QFile::remove(unpack_file);
+        qWarning() << "failed to extract archive:" << m_file;
         settings::instance()->set_module_checksum(name, {});
+        settings::instance()->set_module_stamp(name, {});
         return false;
     }
 
     settings::instance()->set_module_checksum(
         name, checksum_tools::make_checksum(m_file));
-
-    QFile::remove(unpack_file);
+    settings::instance()->set_module_stamp(name, make_module_stamp(m_file));
 
     qDebug() << "module successfully unpacked:" << name;
 
@@ -202,16 +207,24 @@ bool module_unpacked(const QString& name) {
         return false;
     }
 
-    if (old_checksum != checksum_tools::make_checksum(m_file)) {
-        qDebug() << "module checksum is invalid, need to unpack";
-        return false;
-    }
-
     if (!QFile::exists(unpacked_dir(name))) {
         qDebug() << "no unpacked dir:" << unpacked_dir(name);
         return false;
     }
 
+    auto stamp = make_module_stamp(m_file);
+
+    if (stamp.isEmpty() || stamp != settings::instance()->module_stamp(name)) {
+        qDebug() << "module stamp changed, verifying checksum:" << name;
+
+        if (old_checksum != checksum_tools::make_checksum(m_file)) {
+            qDebug() << "module checksum is invalid, need to unpack";
+            return false;
+        }
+
+        settings::instance()->set_module_stamp(name, stamp);
+    }
+
     qDebug() << "module already unpacked:" << name;
 
     return true;
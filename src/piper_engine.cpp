@@ -8,7 +8,14 @@
 #include "piper_engine.hpp"
 
 #include <fmt/format.h>
+#include <sys/stat.h>
 
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <stdexcept>
+
+#include "engine_plugin.hpp"
 #include "logger.hpp"
 
 piper_engine::piper_engine(config_t config, callbacks_t call_backs)
@@ -22,36 +29,134 @@ piper_engine::~piper_engine() {
 
 bool piper_engine::model_created() const { return static_cast<bool>(m_piper); }
 
-void piper_engine::create_model() {
+// Optimized model depends on source model, so its name is derived from
+// path, size and modification time of source model file.
+std::string piper_engine::optimized_model_file(
+    const std::string& model_file) const {
+    struct stat st {};
+    if (m_config.cache_dir.empty() || stat(model_file.c_str(), &st) != 0)
+        return {};
+
+    auto hash = std::hash<std::string>{}(fmt::format(
+        "{}-{}-{}", model_file, st.st_size, st.st_mtim.tv_sec));
+
+    return fmt::format("{}/piper-{}.onnx", m_config.cache_dir, hash);
+}
+
+void piper_engine::warm_up() {
+    // first inference initializes kernels, so it is done right away instead
+    // of delaying first sentence
+    auto start = std::chrono::steady_clock::now();
+
+    try {
+        m_piper->text_to_audio("a", m_initial_length_scale);
+    } catch (const std::exception& err) {
+        LOGW("warm-up error: " << err.what());
+        return;
+    }
+
+    LOGD("warm-up done: duration="
+         << std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count()
+         << "ms");
+}
+
+void piper_engine::load_model(std::optional<piper_api>& piper,
+                              int num_threads) const {
     auto model_file =
         first_file_with_ext(m_config.model_files.model_path, "onnx");
     auto config_file =
         first_file_with_ext(m_config.model_files.model_path, "json");
 
-    if (model_file.empty() || config_file.empty()) {
-        LOGE("failed to find model or config files");
-        return;
+    if (model_file.empty() || config_file.empty())
+        throw std::runtime_error("failed to find model or config files");
+
+    int64_t speaker_id = -1;
+    try {
+        speaker_id = std::stoll(m_config.speaker_id);
+    } catch ([[maybe_unused]] const std::invalid_argument& err) {
     }
 
+    auto optimized_file = optimized_model_file(model_file);
+
     try {
-        int64_t speaker_id = -1;
-        try {
-            speaker_id = std::stoll(m_config.speaker_id);
-        } catch ([[maybe_unused]] const std::invalid_argument& err) {
-        }
+        piper.emplace(model_file, config_file, m_config.data_dir, speaker_id,
+                      optimized_file, num_threads);
+    } catch (const std::exception& err) {
+        if (optimized_file.empty()) throw;
+
+        // optimized model might be incompatible with current onnxruntime
+        LOGW("failed to load optimized model: " << err.what());
+        std::remove(optimized_file.c_str());
 
-        m_piper.emplace(std::move(model_file), std::move(config_file),
-                        m_config.data_dir, speaker_id);
+        piper.emplace(std::move(model_file), std::move(config_file),
+                      m_config.data_dir, speaker_id, std::string{},
+                      num_threads);
+    }
+}
+
+void piper_engine::create_model() {
+    try {
+        load_model(m_piper, static_cast<int>(m_config.num_threads));
 
         m_initial_length_scale = m_piper->length_scale();
         LOGD("initial length scale: " << m_initial_length_scale);
     } catch (const std::exception& err) {
         LOGE("error: " << err.what());
+        m_piper.reset();
+        return;
     }
+
+    warm_up();
 }
 
 bool piper_engine::model_supports_speed() const { return true; }
 
+void piper_engine::cancel_prerender_impl() {
+    std::lock_guard lock{m_prerender_mtx};
+    if (m_prerender_piper) m_prerender_piper->set_cancelled(true);
+}
+
+bool piper_engine::encode_prerender_speech(const std::string& text,
+                                           const std::string& out_file,
+                                           float length_scale) {
+    {
+        std::lock_guard lock{m_prerender_mtx};
+
+        if (m_prerender_cancelled) return false;
+
+        // main session runs inference in its own pool threads which have
+        // normal priority
+        if (!m_prerender_piper) {
+            try {
+                load_model(m_prerender_piper, 1);
+                LOGD("prerender session created");
+            } catch (const std::exception& err) {
+                LOGE("failed to create prerender session: " << err.what());
+                m_prerender_piper.reset();
+                return false;
+            }
+        }
+
+        m_prerender_piper->set_cancelled(false);
+    }
+
+    // only batch path can be aborted when foreground task arrives
+    try {
+        if (m_prerender_piper->texts_to_wav_files({text}, {out_file},
+                                                  length_scale))
+            return true;
+        if (m_prerender_cancelled) return false;
+        m_prerender_piper->text_to_wav_file(text, out_file, length_scale);
+    } catch (const std::exception& err) {
+        LOGD("prerender aborted: " << err.what());
+        return false;
+    }
+
+    return true;
+}
+
 bool piper_engine::encode_speech_impl(const std::string& text,
                                       const std::string& out_file) {
     auto length_scale =
@@ -59,6 +164,9 @@ bool piper_engine::encode_speech_impl(const std::string& text,
 
     LOGD("length_scale: " << length_scale);
 
+    if (m_prerendering)
+        return encode_prerender_speech(text, out_file, length_scale);
+
     try {
         m_piper->text_to_wav_file(text, out_file, length_scale);
     } catch (const std::exception& err) {
@@ -70,3 +178,34 @@ bool piper_engine::encode_speech_impl(const std::string& text,
 
     return true;
 }
+
+bool piper_engine::encode_speech_batch_impl(
+    const std::vector<std::string>& texts,
+    const std::vector<std::string>& out_files) {
+    auto length_scale =
+        vits_length_scale(m_config.speech_speed, m_initial_length_scale);
+
+    LOGD("batch size: " << texts.size() << ", length_scale: " << length_scale);
+
+    auto start = std::chrono::steady_clock::now();
+
+    try {
+        if (!m_piper->texts_to_wav_files(texts, out_files, length_scale)) {
+            LOGD("batch not supported by model");
+            return false;
+        }
+    } catch (const std::exception& err) {
+        LOGE("batch error: " << err.what());
+        return false;
+    }
+
+    LOGD("voice synthesized successfully in batch: duration="
+         << std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count()
+         << "ms");
+
+    return true;
+}
+
+ENGINE_PLUGIN_TTS(piper_engine)
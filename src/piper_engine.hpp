@@ -10,8 +10,10 @@
 
 #include <piper_api.h>
 
+#include <mutex>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "tts_engine.hpp"
 
@@ -22,13 +24,27 @@ class piper_engine : public tts_engine {
 
    private:
     std::optional<piper_api> m_piper;
+    // session with single intra-op thread, so inference runs in calling
+    // low priority thread, created on first prerender and kept
+    std::optional<piper_api> m_prerender_piper;
+    std::mutex m_prerender_mtx;
     float m_initial_length_scale = 1.0F;
 
     bool model_created() const final;
     bool model_supports_speed() const final;
     void create_model() final;
+    void load_model(std::optional<piper_api>& piper, int num_threads) const;
+    void cancel_prerender_impl() final;
+    bool encode_prerender_speech(const std::string& text,
+                                 const std::string& out_file,
+                                 float length_scale);
+    std::string optimized_model_file(const std::string& model_file) const;
+    void warm_up();
     bool encode_speech_impl(const std::string& text,
                             const std::string& out_file) final;
+    bool encode_speech_batch_impl(
+        const std::vector<std::string>& texts,
+        const std::vector<std::string>& out_files) final;
 };
 
 #endif  // PIPER_ENGINE_HPP
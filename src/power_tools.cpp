@@ -0,0 +1,120 @@
+/* Copyright (C) 2023 Michal Kosciesza <michal@mkiol.net>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "power_tools.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+
+std::ostream& operator<<(std::ostream& os,
+                         power_tools::power_source_t power_source) {
+    switch (power_source) {
+        case power_tools::power_source_t::ac:
+            os << "ac";
+            break;
+        case power_tools::power_source_t::battery:
+            os << "battery";
+            break;
+        case power_tools::power_source_t::unknown:
+            os << "unknown";
+            break;
+    }
+
+    return os;
+}
+
+namespace power_tools {
+static std::string read_value(const std::filesystem::path& file) {
+    std::ifstream is{file};
+    std::string value;
+    std::getline(is, value);
+    return value;
+}
+
+static std::optional<long> read_number(const std::filesystem::path& file) {
+    auto value = read_value(file);
+    if (value.empty()) return std::nullopt;
+
+    char* end = nullptr;
+    auto number = std::strtol(value.c_str(), &end, 10);
+    if (end == value.c_str()) return std::nullopt;
+
+    return number;
+}
+
+std::string sysfs_class_dir() {
+    const auto* dir = std::getenv("DSNOTE_SYSFS_CLASS_DIR");
+    return dir ? dir : "/sys/class";
+}
+
+power_source_t power_source(const std::string& class_dir) {
+    std::error_code ec;
+    std::filesystem::directory_iterator it{
+        std::filesystem::path{class_dir} / "power_supply", ec};
+    if (ec) return power_source_t::unknown;
+
+    bool mains_present = false;
+    bool mains_online = false;
+    bool battery_present = false;
+    bool battery_discharging = false;
+
+    for (const auto& entry : it) {
+        const auto& path = entry.path();
+        auto type = read_value(path / "type");
+
+        if (type == "Mains" || type == "USB") {
+            mains_present = true;
+            if (read_number(path / "online").value_or(0) > 0)
+                mains_online = true;
+        } else if (type == "Battery") {
+            // batteries of peripheral devices (mouse, headset) have
+            // "Device" scope
+            if (read_value(path / "scope") == "Device") continue;
+            battery_present = true;
+            if (read_value(path / "status") == "Discharging")
+                battery_discharging = true;
+        }
+    }
+
+    if (mains_online) return power_source_t::ac;
+    if (battery_discharging) return power_source_t::battery;
+    if (battery_present && mains_present) return power_source_t::battery;
+    if (mains_present) return power_source_t::ac;
+
+    return power_source_t::unknown;
+}
+
+bool thermal_throttled(const std::string& class_dir) {
+    std::error_code ec;
+    std::filesystem::directory_iterator it{
+        std::filesystem::path{class_dir} / "thermal", ec};
+    if (ec) return false;
+
+    for (const auto& entry : it) {
+        const auto& path = entry.path();
+        if (path.filename().string().rfind("thermal_zone", 0) != 0) continue;
+
+        auto temp = read_number(path / "temp");
+        if (!temp) continue;
+
+        for (int i = 0;; ++i) {
+            auto type_file =
+                path / ("trip_point_" + std::to_string(i) + "_type");
+            if (!std::filesystem::exists(type_file, ec)) break;
+            if (read_value(type_file) != "passive") continue;
+
+            auto trip = read_number(
+                path / ("trip_point_" + std::to_string(i) + "_temp"));
+            if (trip && *trip > 0 && *temp >= *trip) return true;
+        }
+    }
+
+    return false;
+}
+}  // namespace power_tools
@@ -0,0 +1,28 @@
+/* Copyright (C) 2023 Michal Kosciesza <michal@mkiol.net>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWER_TOOLS_HPP
+#define POWER_TOOLS_HPP
+
+#include <iostream>
+#include <string>
+
+namespace power_tools {
+enum class power_source_t { unknown, ac, battery };
+
+// sysfs class dir is /sys/class unless DSNOTE_SYSFS_CLASS_DIR is set,
+// the variable allows to test with fake power_supply and thermal dirs
+std::string sysfs_class_dir();
+power_source_t power_source(const std::string& class_dir = sysfs_class_dir());
+// true when any thermal zone reached its passive (throttling) trip point
+bool thermal_throttled(const std::string& class_dir = sysfs_class_dir());
+}  // namespace power_tools
+
+std::ostream& operator<<(std::ostream& os,
+                         power_tools::power_source_t power_source);
+
+#endif // POWER_TOOLS_HPP
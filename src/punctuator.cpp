@@ -9,7 +9,9 @@
 
 #include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <numeric>
+#include <sstream>
 
 #include "logger.hpp"
 #include "py_executor.hpp"
@@ -119,3 +121,78 @@ std::string punctuator::process(std::string text) {
         return text;
     }
 }
+
+std::vector<std::string> punctuator::split_words(const std::string& text) {
+    std::istringstream is{text};
+    return {std::istream_iterator<std::string>{is},
+            std::istream_iterator<std::string>{}};
+}
+
+std::string punctuator::join_words(
+    std::vector<std::string>::const_iterator beg,
+    std::vector<std::string>::const_iterator end) {
+    std::string text;
+
+    for (auto it = beg; it != end; ++it) {
+        if (!text.empty()) text += ' ';
+        text += *it;
+    }
+
+    return text;
+}
+
+void punctuator::reset_incremental() {
+    m_frozen_words.clear();
+    m_frozen_punctuated_words.clear();
+}
+
+// Only words that were not punctuated yet (plus a few preceding words as
+// context) are sent to the model. Words far enough from the end of text are
+// frozen, so the cost of each update does not depend on the text length.
+std::string punctuator::process_incremental(const std::string& text) {
+    auto words = split_words(text);
+
+    size_t frozen = 0;
+    while (frozen < m_frozen_words.size() && frozen < words.size() &&
+           m_frozen_words[frozen] == words[frozen])
+        ++frozen;
+
+    m_frozen_words.resize(frozen);
+    m_frozen_punctuated_words.resize(frozen);
+
+    if (frozen == words.size())
+        return join_words(m_frozen_punctuated_words.cbegin(),
+                          m_frozen_punctuated_words.cend());
+
+    auto context = std::min(m_left_context_size, frozen);
+    auto tail_beg = std::next(words.cbegin(), frozen - context);
+
+    auto punctuated_words =
+        split_words(process(join_words(tail_beg, words.cend())));
+
+    if (punctuated_words.size() !=
+        static_cast<size_t>(std::distance(tail_beg, words.cend()))) {
+        LOGD("punctuated words do not match, processing whole text");
+        reset_incremental();
+        return process(text);
+    }
+
+    punctuated_words.erase(punctuated_words.begin(),
+                           std::next(punctuated_words.begin(), context));
+
+    auto freeze_to =
+        words.size() > m_unstable_size ? words.size() - m_unstable_size : 0;
+    for (auto i = frozen; i < freeze_to; ++i) {
+        m_frozen_words.push_back(words[i]);
+        m_frozen_punctuated_words.push_back(punctuated_words[i - frozen]);
+    }
+
+    auto result = join_words(
+        m_frozen_punctuated_words.cbegin(),
+        std::next(m_frozen_punctuated_words.cbegin(), frozen));
+    auto tail = join_words(punctuated_words.cbegin(), punctuated_words.cend());
+
+    if (!result.empty() && !tail.empty()) result += ' ';
+
+    return result + tail;
+}
@@ -15,6 +15,7 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace py = pybind11;
 
@@ -23,9 +24,22 @@ class punctuator {
     punctuator(const std::string& model_path, int device = -1);
     ~punctuator();
     std::string process(std::string text);
+    std::string process_incremental(const std::string& text);
+    void reset_incremental();
 
    private:
+    // words before the not yet punctuated part given as context
+    inline static const size_t m_left_context_size = 10;
+    // last words which are punctuated again with every update
+    inline static const size_t m_unstable_size = 8;
+
     std::optional<py::object> m_pipeline;
+    std::vector<std::string> m_frozen_words;
+    std::vector<std::string> m_frozen_punctuated_words;
+
+    static std::vector<std::string> split_words(const std::string& text);
+    static std::string join_words(std::vector<std::string>::const_iterator beg,
+                                  std::vector<std::string>::const_iterator end);
 };
 
 #endif  // PUNCTUATOR_H
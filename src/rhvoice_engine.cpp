@@ -14,6 +14,7 @@
 #include <cstdlib>
 #include <fstream>
 
+#include "engine_plugin.hpp"
 #include "logger.hpp"
 
 rhvoice_engine::rhvoice_engine(config_t config, callbacks_t call_backs)
@@ -190,3 +191,5 @@ bool rhvoice_engine::encode_speech_impl(const std::string& text,
 
     return true;
 }
+
+ENGINE_PLUGIN_TTS(rhvoice_engine)
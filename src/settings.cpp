@@ -17,6 +17,7 @@
 #include <QGuiApplication>
 #include <QRegExp>
 #include <QStandardPaths>
+#include <QThread>
 #include <QVariant>
 #include <QVariantList>
 #include <algorithm>
@@ -128,12 +129,32 @@ settings::settings() : QSettings{settings_filepath(), QSettings::NativeFormat} {
     enforce_num_threads();
     update_audio_inputs();
 
+    m_sync_timer.setSingleShot(true);
+    m_sync_timer.setInterval(sync_delay);
+    connect(&m_sync_timer, &QTimer::timeout, this, [this] { sync(); });
+
     // remove qml cache
     QDir{QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
          "/qmlcache"}
         .removeRecursively();
 }
 
+// Bursts of changes are written to disk with one sync. Use flush() when other
+// process has to see changes immediately.
+void settings::schedule_sync() {
+    if (QThread::currentThread() == thread()) {
+        m_sync_timer.start();
+    } else {
+        QMetaObject::invokeMethod(
+            this, [this] { m_sync_timer.start(); }, Qt::QueuedConnection);
+    }
+}
+
+void settings::flush() {
+    if (QThread::currentThread() == thread()) m_sync_timer.stop();
+    sync();
+}
+
 QString settings::settings_filepath() {
     QDir conf_dir{
         QStandardPaths::writableLocation(QStandardPaths::ConfigLocation)};
@@ -282,7 +303,7 @@ void settings::set_default_stt_model_for_lang(const QString& lang,
                                               const QString& value) {
     if (default_stt_model_for_lang(lang) != value) {
         setValue(QStringLiteral("service/default_model_%1").arg(lang), value);
-        sync();
+        schedule_sync();
         emit default_stt_models_changed(lang);
     }
 }
@@ -297,7 +318,7 @@ void settings::set_default_tts_model_for_lang(const QString& lang,
     if (default_tts_model_for_lang(lang) != value) {
         setValue(QStringLiteral("service/default_tts_model_%1").arg(lang),
                  value);
-        sync();
+        schedule_sync();
         emit default_tts_models_changed(lang);
     }
 }
@@ -313,6 +334,82 @@ void settings::set_restore_punctuation(bool value) {
     }
 }
 
+bool settings::stt_low_latency() const {
+    return value(QStringLiteral("service/stt_low_latency"), false).toBool();
+}
+
+void settings::set_stt_low_latency(bool value) {
+    if (stt_low_latency() != value) {
+        setValue(QStringLiteral("service/stt_low_latency"), value);
+        emit stt_low_latency_changed();
+    }
+}
+
+int settings::stt_vad_window() const {
+    return value(QStringLiteral("service/stt_vad_window"), 0).toInt();
+}
+
+void settings::set_stt_vad_window(int value) {
+    value = std::max(0, value);
+    if (stt_vad_window() != value) {
+        setValue(QStringLiteral("service/stt_vad_window"), value);
+        emit stt_vad_window_changed();
+    }
+}
+
+bool settings::stt_native_endpointing() const {
+    return value(QStringLiteral("service/stt_native_endpointing"), false)
+        .toBool();
+}
+
+void settings::set_stt_native_endpointing(bool value) {
+    if (stt_native_endpointing() != value) {
+        setValue(QStringLiteral("service/stt_native_endpointing"), value);
+        emit stt_native_endpointing_changed();
+    }
+}
+
+bool settings::stt_cascade() const {
+    return value(QStringLiteral("service/stt_cascade"), false).toBool();
+}
+
+void settings::set_stt_cascade(bool value) {
+    if (stt_cascade() != value) {
+        setValue(QStringLiteral("service/stt_cascade"), value);
+        emit stt_cascade_changed();
+    }
+}
+
+settings::decoding_profile_t settings::stt_live_decoding_profile() const {
+    return static_cast<decoding_profile_t>(
+        value(QStringLiteral("service/stt_live_decoding_profile"),
+              static_cast<int>(decoding_profile_t::DecodingProfileFast))
+            .toInt());
+}
+
+void settings::set_stt_live_decoding_profile(decoding_profile_t value) {
+    if (stt_live_decoding_profile() != value) {
+        setValue(QStringLiteral("service/stt_live_decoding_profile"),
+                 static_cast<int>(value));
+        emit stt_live_decoding_profile_changed();
+    }
+}
+
+settings::decoding_profile_t settings::stt_file_decoding_profile() const {
+    return static_cast<decoding_profile_t>(
+        value(QStringLiteral("service/stt_file_decoding_profile"),
+              static_cast<int>(decoding_profile_t::DecodingProfileBalanced))
+            .toInt());
+}
+
+void settings::set_stt_file_decoding_profile(decoding_profile_t value) {
+    if (stt_file_decoding_profile() != value) {
+        setValue(QStringLiteral("service/stt_file_decoding_profile"),
+                 static_cast<int>(value));
+        emit stt_file_decoding_profile_changed();
+    }
+}
+
 QString settings::py_path() const {
     return value(QStringLiteral("service/py_path"), {}).toString();
 }
@@ -828,6 +925,17 @@ void settings::set_module_checksum(const QString& name, const QString& value) {
     }
 }
 
+QString settings::module_stamp(const QString& name) const {
+    return value(QStringLiteral("service/module_%1_stamp").arg(name))
+        .toString();
+}
+
+void settings::set_module_stamp(const QString& name, const QString& value) {
+    if (value != module_stamp(name)) {
+        setValue(QStringLiteral("service/module_%1_stamp").arg(name), value);
+    }
+}
+
 QString settings::prev_app_ver() const {
     return value(QStringLiteral("prev_app_ver")).toString();
 }
@@ -1036,14 +1144,18 @@ void settings::update_qt_style(QQmlApplicationEngine* engine) const {
 }
 #endif
 
-void settings::enforce_num_threads() const {
+// 0 means that number of threads is not limited
+unsigned int settings::effective_num_threads() const {
     unsigned int conf_num_threads = num_threads();
 
-    unsigned int num_threads =
-        conf_num_threads > 0
-            ? std::min(conf_num_threads,
-                       std::max(std::thread::hardware_concurrency(), 2u) - 1)
-            : 0;
+    return conf_num_threads > 0
+               ? std::min(conf_num_threads,
+                          std::max(std::thread::hardware_concurrency(), 2u) - 1)
+               : 0;
+}
+
+void settings::enforce_num_threads() const {
+    auto num_threads = effective_num_threads();
 
     qDebug() << "enforcing num threads:" << num_threads;
 
@@ -1293,6 +1405,17 @@ void settings::set_diacritizer_enabled(bool value) {
     }
 }
 
+bool settings::tts_prerender() const {
+    return value(QStringLiteral("tts_prerender"), false).toBool();
+}
+
+void settings::set_tts_prerender(bool value) {
+    if (value != tts_prerender()) {
+        setValue(QStringLiteral("tts_prerender"), value);
+        emit tts_prerender_changed();
+    }
+}
+
 int settings::num_threads() const {
     auto num_threads = value(QStringLiteral("service/num_threads"), 0).toInt();
     return num_threads < 0 ? 0 : num_threads;
@@ -1308,6 +1431,21 @@ void settings::set_num_threads(int value) {
     }
 }
 
+settings::performance_profile_t settings::performance_profile() const {
+    return static_cast<performance_profile_t>(
+        value(QStringLiteral("service/performance_profile"),
+              static_cast<int>(performance_profile_t::PerformanceProfileAuto))
+            .toInt());
+}
+
+void settings::set_performance_profile(performance_profile_t value) {
+    if (performance_profile() != value) {
+        setValue(QStringLiteral("service/performance_profile"),
+                 static_cast<int>(value));
+        emit performance_profile_changed();
+    }
+}
+
 QString settings::hotkey_start_listening() const {
     return value(QStringLiteral("hotkey_start_listening"),
                  QStringLiteral("Ctrl+Alt+Shift+L"))
@@ -12,6 +12,7 @@
 #include <QSettings>
 #include <QString>
 #include <QStringList>
+#include <QTimer>
 #include <QUrl>
 #ifdef USE_DESKTOP
 #include <QQmlApplicationEngine>
@@ -118,6 +119,8 @@ class settings : public QSettings, public singleton<settings> {
                    set_actions_api_enabled NOTIFY actions_api_enabled_changed)
     Q_PROPERTY(bool diacritizer_enabled READ diacritizer_enabled WRITE
                    set_diacritizer_enabled NOTIFY diacritizer_enabled_changed)
+    Q_PROPERTY(bool tts_prerender READ tts_prerender WRITE set_tts_prerender
+                   NOTIFY tts_prerender_changed)
     Q_PROPERTY(bool gpu_scan_cuda READ gpu_scan_cuda WRITE set_gpu_scan_cuda
                    NOTIFY gpu_scan_cuda_changed)
     Q_PROPERTY(bool gpu_scan_hip READ gpu_scan_hip WRITE set_gpu_scan_hip NOTIFY
@@ -163,6 +166,21 @@ class settings : public QSettings, public singleton<settings> {
                    NOTIFY cache_dir_changed)
     Q_PROPERTY(bool restore_punctuation READ restore_punctuation WRITE
                    set_restore_punctuation NOTIFY restore_punctuation_changed)
+    Q_PROPERTY(bool stt_low_latency READ stt_low_latency WRITE
+                   set_stt_low_latency NOTIFY stt_low_latency_changed)
+    Q_PROPERTY(int stt_vad_window READ stt_vad_window WRITE set_stt_vad_window
+                   NOTIFY stt_vad_window_changed)
+    Q_PROPERTY(bool stt_native_endpointing READ stt_native_endpointing WRITE
+                   set_stt_native_endpointing NOTIFY
+                       stt_native_endpointing_changed)
+    Q_PROPERTY(bool stt_cascade READ stt_cascade WRITE set_stt_cascade NOTIFY
+                   stt_cascade_changed)
+    Q_PROPERTY(decoding_profile_t stt_live_decoding_profile READ
+                   stt_live_decoding_profile WRITE set_stt_live_decoding_profile
+                       NOTIFY stt_live_decoding_profile_changed)
+    Q_PROPERTY(decoding_profile_t stt_file_decoding_profile READ
+                   stt_file_decoding_profile WRITE set_stt_file_decoding_profile
+                       NOTIFY stt_file_decoding_profile_changed)
     Q_PROPERTY(QString default_stt_model READ default_stt_model WRITE
                    set_default_stt_model NOTIFY default_stt_model_changed)
     Q_PROPERTY(QString default_tts_model READ default_tts_model WRITE
@@ -203,6 +221,9 @@ class settings : public QSettings, public singleton<settings> {
                    set_cache_policy NOTIFY cache_policy_changed)
     Q_PROPERTY(int num_threads READ num_threads WRITE set_num_threads NOTIFY
                    num_threads_changed)
+    Q_PROPERTY(performance_profile_t performance_profile READ
+                   performance_profile WRITE set_performance_profile NOTIFY
+                       performance_profile_changed)
     Q_PROPERTY(
         QString py_path READ py_path WRITE set_py_path NOTIFY py_path_changed)
     Q_PROPERTY(bool gpu_override_version READ gpu_override_version WRITE
@@ -276,15 +297,33 @@ class settings : public QSettings, public singleton<settings> {
     };
     Q_ENUM(text_format_t)
 
+    enum class decoding_profile_t {
+        DecodingProfileFast = 0,
+        DecodingProfileBalanced = 1,
+        DecodingProfileAccurate = 2
+    };
+    Q_ENUM(decoding_profile_t)
+
+    enum class performance_profile_t {
+        PerformanceProfileAuto = 0,
+        PerformanceProfilePowerSaver = 1,
+        PerformanceProfileBalanced = 2,
+        PerformanceProfileMaxThroughput = 3
+    };
+    Q_ENUM(performance_profile_t)
+
     settings();
 
     launch_mode_t launch_mode() const;
     void set_launch_mode(launch_mode_t launch_mode);
     QString module_checksum(const QString &name) const;
     void set_module_checksum(const QString &name, const QString &value);
+    QString module_stamp(const QString &name) const;
+    void set_module_stamp(const QString &name, const QString &value);
     void scan_gpu_devices();
     void disable_gpu_scan();
     void disable_py_scan();
+    void flush();
 #ifdef USE_DESKTOP
     void update_qt_style(QQmlApplicationEngine *engine) const;
 #endif
@@ -373,6 +412,8 @@ class settings : public QSettings, public singleton<settings> {
     void set_actions_api_enabled(bool value);
     bool diacritizer_enabled() const;
     void set_diacritizer_enabled(bool value);
+    bool tts_prerender() const;
+    void set_tts_prerender(bool value);
     bool gpu_scan_cuda() const;
     void set_gpu_scan_cuda(bool value);
     bool gpu_scan_hip() const;
@@ -442,6 +483,18 @@ class settings : public QSettings, public singleton<settings> {
     void set_cache_dir_url(const QUrl &value);
     bool restore_punctuation() const;
     void set_restore_punctuation(bool value);
+    bool stt_low_latency() const;
+    void set_stt_low_latency(bool value);
+    int stt_vad_window() const;
+    void set_stt_vad_window(int value);
+    bool stt_native_endpointing() const;
+    void set_stt_native_endpointing(bool value);
+    bool stt_cascade() const;
+    void set_stt_cascade(bool value);
+    decoding_profile_t stt_live_decoding_profile() const;
+    void set_stt_live_decoding_profile(decoding_profile_t value);
+    decoding_profile_t stt_file_decoding_profile() const;
+    void set_stt_file_decoding_profile(decoding_profile_t value);
     QStringList enabled_models();
     void set_enabled_models(const QStringList &value);
     QStringList audio_inputs() const;
@@ -452,7 +505,10 @@ class settings : public QSettings, public singleton<settings> {
     bool py_feature_scan() const;
     void set_py_feature_scan(bool value);
     int num_threads() const;
+    unsigned int effective_num_threads() const;
     void set_num_threads(int value);
+    performance_profile_t performance_profile() const;
+    void set_performance_profile(performance_profile_t value);
     QString py_path() const;
     void set_py_path(const QString &value);
 
@@ -528,6 +584,7 @@ class settings : public QSettings, public singleton<settings> {
     void desktop_notification_policy_changed();
     void actions_api_enabled_changed();
     void diacritizer_enabled_changed();
+    void tts_prerender_changed();
     void gpu_scan_cuda_changed();
     void gpu_scan_hip_changed();
     void gpu_scan_opencl_changed();
@@ -548,6 +605,12 @@ class settings : public QSettings, public singleton<settings> {
     void models_dir_changed();
     void cache_dir_changed();
     void restore_punctuation_changed();
+    void stt_low_latency_changed();
+    void stt_vad_window_changed();
+    void stt_native_endpointing_changed();
+    void stt_cascade_changed();
+    void stt_live_decoding_profile_changed();
+    void stt_file_decoding_profile_changed();
     void default_stt_model_changed();
     void default_stt_models_changed(const QString &lang);
     void default_tts_model_changed();
@@ -563,11 +626,13 @@ class settings : public QSettings, public singleton<settings> {
     void cache_audio_format_changed();
     void cache_policy_changed();
     void num_threads_changed();
+    void performance_profile_changed();
     void py_path_changed();
     void gpu_override_version_changed();
     void gpu_overrided_version_changed();
 
    private:
+    static const int sync_delay = 500;  // msec
     inline static const QString settings_filename =
         QStringLiteral("settings.conf");
     inline static const QString default_qt_style =
@@ -579,8 +644,10 @@ class settings : public QSettings, public singleton<settings> {
     QStringList m_gpu_devices_tts;
     std::vector<QString> m_rocm_gpu_versions;
     QStringList m_audio_inputs;
+    QTimer m_sync_timer;
 
     static QString settings_filepath();
+    void schedule_sync();
     void update_audio_inputs();
     void set_restart_required(bool value);
     void enforce_num_threads() const;
@@ -50,8 +50,8 @@ ModelsListModel *speech_config::models_model() { return &m_models_model; }
 LangsListModel *speech_config::langs_model() { return &m_langs_model; }
 
 QVariantList speech_config::available_models() const {
-    const auto available_models_list =
-        models_manager::instance()->available_models();
+    const auto catalog = models_manager::instance()->catalog();
+    const auto &available_models_list = catalog->available_models;
 
     QVariantList list;
     std::transform(available_models_list.cbegin(), available_models_list.cend(),
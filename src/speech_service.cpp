@@ -10,31 +10,34 @@
 #include <fmt/format.h>
 
 #include <QCoreApplication>
+#include <QDBusArgument>
 #include <QDBusConnection>
 #include <QDebug>
 #include <QEventLoop>
 #include <algorithm>
 #include <cstdlib>
 #include <functional>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <set>
+#include <thread>
+#include <unordered_map>
 
-#include "april_engine.hpp"
 #include "coqui_engine.hpp"
 #include "ds_engine.hpp"
-#include "espeak_engine.hpp"
+#include "engine_plugin.hpp"
 #include "fasterwhisper_engine.hpp"
+#include "fd_tools.hpp"
 #include "file_source.h"
 #include "gpu_tools.hpp"
 #include "media_compressor.hpp"
 #include "mic_source.h"
 #include "mimic3_engine.hpp"
 #include "module_tools.hpp"
-#include "piper_engine.hpp"
+#include "power_tools.hpp"
 #include "py_executor.hpp"
 #include "py_tools.hpp"
-#include "rhvoice_engine.hpp"
 #include "settings.h"
 #include "text_tools.hpp"
 #include "vosk_engine.hpp"
@@ -142,6 +145,8 @@ speech_service::speech_service(QObject *parent)
     : QObject{parent}, m_dbus_service_adaptor{this} {
     qDebug() << "starting service:" << settings::instance()->launch_mode();
 
+    engine_plugin::discover();
+
     connect(models_manager::instance(), &models_manager::models_changed, this,
             &speech_service::handle_models_changed);
     connect(models_manager::instance(), &models_manager::busy_changed, this,
@@ -182,8 +187,21 @@ speech_service::speech_service(QObject *parent)
             static_cast<void (speech_service::*)(tts_partial_result_t)>(
                 &speech_service::handle_tts_speech_encoded),
             Qt::QueuedConnection);
+    connect(
+        this, &speech_service::mnt_translate_finished, this,
+        [this](const QString &, const QString &, const QString &out_text,
+               const QString &, int task) {
+            handle_interpret_translated(out_text, task);
+        },
+        Qt::QueuedConnection);
     connect(this, &speech_service::stt_engine_shutdown, this,
             [this] { stop_stt_engine(); });
+    connect(this, &speech_service::current_task_changed, this, [this] {
+        if (m_current_task) cancel_tts_prerender();
+        // engines now belong to the new task
+        if (m_interpret_task && current_task_id() != *m_interpret_task)
+            reset_interpret();
+    });
     connect(
         this, &speech_service::requet_update_task_state, this,
         [this] { update_task_state(); }, Qt::QueuedConnection);
@@ -276,6 +294,30 @@ speech_service::speech_service(QObject *parent)
             emit default_mnt_out_lang_changed();
         },
         Qt::QueuedConnection);
+    connect(
+        settings::instance(), &settings::performance_profile_changed, this,
+        [this]() {
+            if (settings::instance()->launch_mode() ==
+                settings::launch_mode_t::service) {
+                auto profile = dbus_performance_profile();
+                qDebug() << "[service => dbus] signal "
+                            "PerformanceProfilePropertyChanged:"
+                         << profile;
+                emit PerformanceProfilePropertyChanged(profile);
+            }
+
+            update_performance_profile();
+        },
+        Qt::QueuedConnection);
+
+    // battery and thermal state are polled because sysfs does not
+    // notify about changes
+    m_power_state_timer.setTimerType(Qt::VeryCoarseTimer);
+    m_power_state_timer.setInterval(POWER_STATE_CHECK_TIME);
+    connect(&m_power_state_timer, &QTimer::timeout, this,
+            &speech_service::update_performance_profile);
+    m_power_state_timer.start();
+    update_performance_profile();
 
     if (settings::instance()->launch_mode() ==
         settings::launch_mode_t::service) {
@@ -348,11 +390,40 @@ speech_service::speech_service(QObject *parent)
             this, &speech_service::mnt_translate_finished, this,
             [this](const QString &in_text, const QString &in_lang,
                    const QString &out_text, const QString &out_lang, int task) {
+                if (task == m_fd_result_task) {
+                    m_fd_result_task = INVALID_TASK;
+
+                    auto fd = fd_tools::make_text_fd(out_text.toStdString());
+                    if (fd >= 0) {
+                        QDBusUnixFileDescriptor out_text_fd;
+                        out_text_fd.giveFileDescriptor(fd);
+
+                        qDebug() << "[service => dbus] signal "
+                                    "MntTranslateFdFinished:"
+                                 << task;
+                        emit MntTranslateFdFinished(out_text_fd, in_lang,
+                                                    out_lang, task);
+                        return;
+                    }
+
+                    qWarning() << "failed to make text fd";
+                }
+
                 qDebug() << "[service => dbus] signal MntTranslateFinished:"
                          << task;
                 emit MntTranslateFinished(in_text, in_lang, out_text, out_lang,
                                           task);
             });
+        connect(
+            this, &speech_service::mnt_translate_batch_finished, this,
+            [this](const QString &in_lang, const QStringList &out_texts,
+                   const QString &out_lang, int task) {
+                qDebug()
+                    << "[service => dbus] signal MntTranslateBatchFinished:"
+                    << task;
+                emit MntTranslateBatchFinished(in_lang, out_texts, out_lang,
+                                               task);
+            });
         connect(
             this, &speech_service::task_state_changed, this,
             [this]() {
@@ -867,7 +938,8 @@ std::optional<speech_service::model_config_t>
 speech_service::choose_model_config(engine_t engine_type,
                                     QString model_or_lang_id,
                                     QString out_lang_id) {
-    auto models = models_manager::instance()->available_models();
+    const auto catalog = models_manager::instance()->catalog();
+    const auto &models = catalog->available_models;
 
     fill_available_models_map(models);
 
@@ -959,7 +1031,8 @@ speech_service::choose_model_config(engine_t engine_type,
 }
 
 void speech_service::handle_models_changed() {
-    fill_available_models_map(models_manager::instance()->available_models());
+    fill_available_models_map(
+        models_manager::instance()->catalog()->available_models);
 
     if (m_current_task &&
         (m_available_stt_models_map.find(m_current_task->model_id) ==
@@ -985,6 +1058,42 @@ QString speech_service::lang_from_model_id(const QString &model_id) {
     return l.first();
 }
 
+// Non-breaking prefixes are parsed only once per lang and the same splitter
+// is shared by all engines.
+text_tools::nb_splitter_t speech_service::nb_splitter_for_lang(
+    const QString &lang) {
+    static std::unordered_map<QString, text_tools::nb_splitter_t> splitters;
+    static std::mutex mutex;
+
+    auto load = [](const QString &lang) -> text_tools::nb_splitter_t {
+        QFile nb_file{
+            QStringLiteral(":/nonbreaking_prefixes/%1.txt").arg(lang)};
+        if (!nb_file.open(QIODevice::ReadOnly | QIODevice::Text)) return {};
+        return text_tools::make_nb_splitter(nb_file.readAll().toStdString());
+    };
+
+    std::lock_guard lock{mutex};
+
+    if (auto it = splitters.find(lang); it != splitters.end())
+        return it->second;
+
+    auto splitter = load(lang);
+
+    if (!splitter) {  // fallback to en
+        const auto en = QStringLiteral("en");
+        if (auto it = splitters.find(en); it != splitters.end()) {
+            splitter = it->second;
+        } else {
+            splitter = load(en);
+            splitters.emplace(en, splitter);
+        }
+    }
+
+    splitters.emplace(lang, splitter);
+
+    return splitter;
+}
+
 template <typename Engine>
 static std::optional<typename Engine::gpu_device_t> make_gpu_device(
     const QString &gpu_str, const QString &auto_device_str) {
@@ -1023,9 +1132,45 @@ static std::optional<typename Engine::gpu_device_t> make_gpu_device(
     return std::nullopt;
 }
 
-QString speech_service::restart_stt_engine(speech_mode_t speech_mode,
-                                           const QString &model_id,
-                                           const QString &out_lang_id) {
+static stt_engine::decoding_profile_t stt_decoding_profile_from_settings(
+    settings::decoding_profile_t profile) {
+    switch (profile) {
+        case settings::decoding_profile_t::DecodingProfileFast:
+            return stt_engine::decoding_profile_t::fast;
+        case settings::decoding_profile_t::DecodingProfileBalanced:
+            return stt_engine::decoding_profile_t::balanced;
+        case settings::decoding_profile_t::DecodingProfileAccurate:
+            return stt_engine::decoding_profile_t::accurate;
+    }
+
+    throw std::runtime_error("invalid decoding profile");
+}
+
+static stt_engine::decoding_profile_t stt_decoding_profile_from_options(
+    const QVariantMap &options, settings::decoding_profile_t default_profile) {
+    if (options.contains(QStringLiteral("decoding_profile"))) {
+        auto name =
+            options.value(QStringLiteral("decoding_profile")).toString();
+        if (name == QStringLiteral("fast"))
+            return stt_engine::decoding_profile_t::fast;
+        if (name == QStringLiteral("balanced"))
+            return stt_engine::decoding_profile_t::balanced;
+        if (name == QStringLiteral("accurate"))
+            return stt_engine::decoding_profile_t::accurate;
+        qWarning() << "invalid decoding profile:" << name;
+    }
+
+    return stt_decoding_profile_from_settings(default_profile);
+}
+
+QString speech_service::restart_stt_engine(
+    speech_mode_t speech_mode, const QString &model_id,
+    const QString &out_lang_id,
+    stt_engine::decoding_profile_t decoding_profile, bool file_source) {
+    // live decoding must keep up with audio using fewer threads
+    if (!file_source && low_power())
+        decoding_profile = stt_engine::decoding_profile_t::fast;
+
     auto model_config = choose_model_config(engine_t::stt, model_id);
     if (model_config && model_config->stt) {
         stt_engine::config_t config;
@@ -1044,6 +1189,14 @@ QString speech_service::restart_stt_engine(speech_mode_t speech_mode,
         config.translate = !out_lang_id.isEmpty() && out_lang_id == "en" &&
                            config.lang != "en";
         config.options = model_config->options.toStdString();
+        config.low_latency = low_latency();
+        config.vad_window_msec = settings::instance()->stt_vad_window();
+        config.native_endpointing =
+            settings::instance()->stt_native_endpointing();
+        config.decoding_profile = decoding_profile;
+        config.file_source = file_source;
+        config.low_power = low_power();
+        config.num_threads = engine_num_threads();
 
         if (settings::instance()->stt_use_gpu() &&
             settings::instance()->has_gpu_device_stt()) {
@@ -1077,12 +1230,18 @@ QString speech_service::restart_stt_engine(speech_mode_t speech_mode,
                 return true;
             if (model_config->stt->engine ==
                     models_manager::model_engine_t::stt_april &&
-                type != typeid(april_engine))
+                !engine_plugin::engine_of_plugin(
+                    engine_plugin::plugin_t::april, type))
                 return true;
 
             if (m_stt_engine->model_files() != config.model_files) return true;
             if (m_stt_engine->lang() != config.lang) return true;
             if (m_stt_engine->translate() != config.translate) return true;
+            if (m_stt_engine->vad_window_msec() != config.vad_window_msec)
+                return true;
+            if (m_stt_engine->native_endpointing() !=
+                config.native_endpointing)
+                return true;
             if (config.use_gpu != m_stt_engine->use_gpu() ||
                 config.gpu_device != m_stt_engine->gpu_device())
                 return true;
@@ -1095,6 +1254,7 @@ QString speech_service::restart_stt_engine(speech_mode_t speech_mode,
             qDebug() << "new stt engine required";
 
             if (m_stt_engine) {
+                stop_stt_preview_engine();
                 m_stt_engine.reset();
                 qDebug() << "stt engine destroyed successfully";
             }
@@ -1116,7 +1276,14 @@ QString speech_service::restart_stt_engine(speech_mode_t speech_mode,
                 /*eof=*/
                 [this]() { handle_stt_engine_eof(); },
                 /*stopped=*/
-                [this]() { handle_stt_engine_error(); }};
+                [this]() { handle_stt_engine_error(); },
+                /*front_end_output=*/
+                [this](const int16_t *data, size_t size) {
+                    std::lock_guard lock{m_stt_preview_mtx};
+                    if (m_stt_preview_engine)
+                        m_stt_preview_engine->push_front_end_samples(data,
+                                                                     size);
+                }};
 
             try {
                 switch (model_config->stt->engine) {
@@ -1137,8 +1304,9 @@ QString speech_service::restart_stt_engine(speech_mode_t speech_mode,
                             std::move(config), std::move(call_backs));
                         break;
                     case models_manager::model_engine_t::stt_april:
-                        m_stt_engine = std::make_unique<april_engine>(
-                            std::move(config), std::move(call_backs));
+                        m_stt_engine = engine_plugin::make_stt_engine(
+                            engine_plugin::plugin_t::april, std::move(config),
+                            std::move(call_backs));
                         break;
                     case models_manager::model_engine_t::ttt_hftc:
                     case models_manager::model_engine_t::tts_coqui:
@@ -1159,11 +1327,17 @@ QString speech_service::restart_stt_engine(speech_mode_t speech_mode,
         } else {
             qDebug() << "new stt engine not required, only restart";
             m_stt_engine->stop();
+            m_stt_engine->set_decoding_profile(decoding_profile);
+            m_stt_engine->set_file_source(file_source);
+            m_stt_engine->set_low_power(low_power());
+            m_stt_engine->set_num_threads(engine_num_threads());
             m_stt_engine->start();
             m_stt_engine->set_speech_mode(
                 static_cast<stt_engine::speech_mode_t>(speech_mode));
         }
 
+        restart_stt_preview_engine(*model_config->stt);
+
         return model_config->stt->model_id;
     }
 
@@ -1171,6 +1345,145 @@ QString speech_service::restart_stt_engine(speech_mode_t speech_mode,
     return {};
 }
 
+std::optional<speech_service::stt_model_config_t>
+speech_service::choose_stt_preview_model_config(const QString &lang_id) const {
+    const auto catalog = models_manager::instance()->catalog();
+    const auto &models = catalog->available_models;
+
+    const models_manager::model_t *best_model = nullptr;
+
+    for (const auto &model : models) {
+        if (model.lang_id != lang_id) continue;
+        if (model.engine != models_manager::model_engine_t::stt_vosk &&
+            model.engine != models_manager::model_engine_t::stt_april &&
+            model.engine != models_manager::model_engine_t::stt_ds)
+            continue;
+        if (!best_model || model.score > best_model->score) best_model = &model;
+    }
+
+    if (!best_model) return std::nullopt;
+
+    auto scorer_file = models_manager::sup_model_file_of_role(
+        models_manager::sup_model_role_t::scorer, best_model->sup_files);
+
+    return stt_model_config_t{
+        best_model->lang_id, best_model->lang_code, best_model->id,
+        best_model->engine,  best_model->model_file,
+        /*scorer_file=*/
+        scorer_file ? scorer_file->get().file : QString{},
+        /*ttt=*/{}};
+}
+
+// In cascade mode, speech detected by the main (accurate) engine is also
+// passed to a fast streaming engine which provides intermediate text.
+// Final text always comes from the main engine.
+void speech_service::restart_stt_preview_engine(
+    const stt_model_config_t &main_config) {
+    if (!settings::instance()->stt_cascade() || low_power() ||
+        (main_config.engine != models_manager::model_engine_t::stt_whisper &&
+         main_config.engine !=
+             models_manager::model_engine_t::stt_fasterwhisper)) {
+        stop_stt_preview_engine();
+        return;
+    }
+
+    auto model_config = choose_stt_preview_model_config(main_config.lang_id);
+    if (!model_config) {
+        qDebug() << "no preview stt model for lang:" << main_config.lang_id;
+        stop_stt_preview_engine();
+        return;
+    }
+
+    stt_engine::config_t config;
+    config.model_files.model_file = model_config->model_file.toStdString();
+    config.model_files.scorer_file = model_config->scorer_file.toStdString();
+    config.lang = model_config->lang_id.toStdString();
+    config.lang_code = model_config->lang_code.toStdString();
+    config.speech_mode = stt_engine::speech_mode_t::automatic;
+    config.external_front_end = true;
+
+    std::unique_ptr<stt_engine> old_engine;
+
+    {
+        std::lock_guard lock{m_stt_preview_mtx};
+
+        if (m_stt_preview_engine &&
+            m_stt_preview_engine->model_files() == config.model_files) {
+            m_stt_preview_engine->stop();
+            m_stt_preview_engine->start();
+            return;
+        }
+
+        old_engine = std::move(m_stt_preview_engine);
+    }
+
+    // samples from main engine are not blocked while engine is being
+    // destroyed or created
+    old_engine.reset();
+
+    qDebug() << "creating preview stt engine:" << model_config->model_id;
+
+    stt_engine::callbacks_t call_backs{
+        /*text_decoded=*/[](const std::string &) {},
+        /*intermediate_text_decoded=*/
+        [this](const std::string &text) {
+            handle_stt_intermediate_text_decoded(text);
+        },
+        /*speech_detection_status_changed=*/
+        [](stt_engine::speech_detection_status_t) {},
+        /*sentence_timeout=*/[]() {},
+        /*eof=*/[]() {},
+        /*stopped=*/
+        [this]() {
+            qWarning() << "preview stt engine error";
+            QMetaObject::invokeMethod(
+                this, [this] { stop_stt_preview_engine(); },
+                Qt::QueuedConnection);
+        },
+        /*front_end_output=*/{}};
+
+    std::unique_ptr<stt_engine> new_engine;
+
+    try {
+        switch (model_config->engine) {
+            case models_manager::model_engine_t::stt_vosk:
+                new_engine = std::make_unique<vosk_engine>(
+                    std::move(config), std::move(call_backs));
+                break;
+            case models_manager::model_engine_t::stt_april:
+                new_engine = engine_plugin::make_stt_engine(
+                    engine_plugin::plugin_t::april, std::move(config),
+                    std::move(call_backs));
+                break;
+            default:
+                new_engine = std::make_unique<ds_engine>(
+                    std::move(config), std::move(call_backs));
+        }
+    } catch (const std::runtime_error &error) {
+        qWarning() << "failed to create preview stt engine:" << error.what();
+        return;
+    }
+
+    new_engine->start();
+
+    std::lock_guard lock{m_stt_preview_mtx};
+    m_stt_preview_engine = std::move(new_engine);
+}
+
+void speech_service::stop_stt_preview_engine() {
+    std::unique_ptr<stt_engine> engine;
+
+    {
+        std::lock_guard lock{m_stt_preview_mtx};
+        engine = std::move(m_stt_preview_engine);
+    }
+
+    if (engine) {
+        engine.reset();
+        qDebug() << "preview stt engine destroyed successfully";
+    }
+}
+
 static tts_engine::audio_format_t format_from_cache_format(
     settings::cache_audio_format_t format) {
     switch (format) {
@@ -1197,6 +1510,9 @@ static QString tts_ref_voice_file_from_options(const QVariantMap &options) {
 
 QString speech_service::restart_tts_engine(const QString &model_id,
                                            const QVariantMap &options) {
+    // restart cancels any prerendering
+    m_tts_prerender_active = false;
+
     auto model_config = choose_model_config(engine_t::tts, model_id);
     if (model_config && model_config->tts) {
         tts_engine::config_t config;
@@ -1212,6 +1528,7 @@ QString speech_service::restart_tts_engine(const QString &model_id,
         config.cache_dir = settings::instance()->cache_dir().toStdString();
         config.speaker_id = model_config->tts->speaker.toStdString();
         config.speech_speed = tts_speech_speed_from_options(options);
+        config.num_threads = engine_num_threads();
         config.options = model_config->options.toStdString();
         config.audio_format = format_from_cache_format(
             settings::instance()->cache_audio_format());
@@ -1242,16 +1559,8 @@ QString speech_service::restart_tts_engine(const QString &model_id,
                     .toStdString();
         }
 
-        QFile nb_file{QStringLiteral(":/nonbreaking_prefixes/%1.txt")
-                          .arg(model_config->tts->lang_id.split('-').first())};
-        if (nb_file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-            config.nb_data = nb_file.readAll().toStdString();
-        } else {  // fallback to en
-            QFile nb_file_en{QStringLiteral(":/nonbreaking_prefixes/en.txt")};
-            if (nb_file_en.open(QIODevice::ReadOnly | QIODevice::Text)) {
-                config.nb_data = nb_file_en.readAll().toStdString();
-            }
-        }
+        config.nb_splitter =
+            nb_splitter_for_lang(model_config->tts->lang_id.split('-').first());
 
         bool new_engine_required = [&] {
             if (!m_tts_engine) return true;
@@ -1263,11 +1572,13 @@ QString speech_service::restart_tts_engine(const QString &model_id,
                 return true;
             if (model_config->tts->engine ==
                 models_manager::model_engine_t::tts_piper &&
-                type != typeid(piper_engine))
+                !engine_plugin::engine_of_plugin(
+                    engine_plugin::plugin_t::piper, type))
                 return true;
             if (model_config->tts->engine ==
                 models_manager::model_engine_t::tts_rhvoice &&
-                type != typeid(rhvoice_engine))
+                !engine_plugin::engine_of_plugin(
+                    engine_plugin::plugin_t::rhvoice, type))
                 return true;
             if (model_config->tts->engine ==
                 models_manager::model_engine_t::tts_mimic3 &&
@@ -1321,15 +1632,17 @@ QString speech_service::restart_tts_engine(const QString &model_id,
                         config.data_dir =
                             module_tools::unpacked_dir("espeakdata")
                                 .toStdString();
-                        m_tts_engine = std::make_unique<piper_engine>(
-                            std::move(config), std::move(call_backs));
+                        m_tts_engine = engine_plugin::make_tts_engine(
+                            engine_plugin::plugin_t::piper, std::move(config),
+                            std::move(call_backs));
                         break;
                     case models_manager::model_engine_t::tts_espeak:
                         config.data_dir =
                             module_tools::unpacked_dir("espeakdata")
                                 .toStdString();
-                        m_tts_engine = std::make_unique<espeak_engine>(
-                            std::move(config), std::move(call_backs));
+                        m_tts_engine = engine_plugin::make_tts_engine(
+                            engine_plugin::plugin_t::espeak, std::move(config),
+                            std::move(call_backs));
                         break;
                     case models_manager::model_engine_t::tts_rhvoice:
                         config.data_dir =
@@ -1338,8 +1651,9 @@ QString speech_service::restart_tts_engine(const QString &model_id,
                         config.config_dir =
                             module_tools::unpacked_dir("rhvoiceconfig")
                                 .toStdString();
-                        m_tts_engine = std::make_unique<rhvoice_engine>(
-                            std::move(config), std::move(call_backs));
+                        m_tts_engine = engine_plugin::make_tts_engine(
+                            engine_plugin::plugin_t::rhvoice, std::move(config),
+                            std::move(call_backs));
                         break;
                     case models_manager::model_engine_t::tts_mimic3:
                         config.data_dir =
@@ -1377,6 +1691,16 @@ QString speech_service::restart_tts_engine(const QString &model_id,
     return {};
 }
 
+void speech_service::cancel_tts_prerender() {
+    if (!m_tts_prerender_active) return;
+
+    qDebug() << "cancelling tts prerender";
+
+    m_tts_prerender_active = false;
+
+    if (m_tts_engine) m_tts_engine->cancel_prerender();
+}
+
 static bool mnt_clean_text_from_options(const QVariantMap &options) {
     if (options.contains(QStringLiteral("clean_text")))
         return options.value(QStringLiteral("clean_text")).toBool();
@@ -1409,6 +1733,52 @@ static mnt_engine::text_format_t mnt_text_fromat_from_settings_format(
     throw std::runtime_error("invalid text format");
 }
 
+// list value of a{sv} received over DBus is QDBusArgument
+static QVariantList variant_list_from_option(const QVariant &value) {
+    if (value.userType() != qMetaTypeId<QDBusArgument>()) return value.toList();
+
+    auto arg = value.value<QDBusArgument>();
+
+    if (arg.currentSignature() == QLatin1String("ai")) {
+        QVariantList list;
+        for (auto i : qdbus_cast<QList<int>>(arg)) list.push_back(i);
+        return list;
+    }
+
+    return qdbus_cast<QVariantList>(arg);
+}
+
+static std::vector<mnt_engine::batch_item_t> mnt_batch_items_from_texts(
+    const QStringList &texts, const QVariantMap &options) {
+    // optional per-item formats, items without valid format use
+    // the "text_format" option
+    auto formats = variant_list_from_option(
+        options.value(QStringLiteral("text_formats")));
+
+    std::vector<mnt_engine::batch_item_t> items;
+    items.reserve(texts.size());
+
+    for (int i = 0; i < texts.size(); ++i) {
+        mnt_engine::batch_item_t item{texts.at(i).toStdString(), {}};
+
+        if (i < formats.size()) {
+            bool ok = false;
+            auto value = formats.at(i).toInt(&ok);
+            if (ok &&
+                value >= static_cast<int>(
+                             settings::text_format_t::TextFormatRaw) &&
+                value <= static_cast<int>(
+                             settings::text_format_t::TextFormatSubRip))
+                item.text_format = mnt_text_fromat_from_settings_format(
+                    static_cast<settings::text_format_t>(value));
+        }
+
+        items.push_back(std::move(item));
+    }
+
+    return items;
+}
+
 QString speech_service::restart_mnt_engine(const QString &model_or_lang_id,
                                            const QString &out_lang_id,
                                            const QVariantMap &options) {
@@ -1428,17 +1798,6 @@ QString speech_service::restart_mnt_engine(const QString &model_or_lang_id,
         config.text_format = mnt_text_fromat_from_settings_format(
             mnt_text_format_from_options(options));
 
-        QFile nb_file{QStringLiteral(":/nonbreaking_prefixes/%1.txt")
-                          .arg(model_config->mnt->lang_id.split('-').first())};
-        if (nb_file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-            config.nb_data = nb_file.readAll().toStdString();
-        } else {  // fallback to en
-            QFile nb_file_en{QStringLiteral(":/nonbreaking_prefixes/en.txt")};
-            if (nb_file_en.open(QIODevice::ReadOnly | QIODevice::Text)) {
-                config.nb_data = nb_file_en.readAll().toStdString();
-            }
-        }
-
         bool new_engine_required = [&] {
             if (!m_mnt_engine) return true;
             if (m_mnt_engine->model_files() != config.model_files) return true;
@@ -1464,6 +1823,13 @@ QString speech_service::restart_mnt_engine(const QString &model_or_lang_id,
                     handle_mnt_translate_finished(
                         in_text, in_lang, std::move(out_text), out_lang);
                 },
+                /*texts_translated=*/
+                [this](const std::string &in_lang,
+                       std::vector<std::string> &&out_texts,
+                       const std::string &out_lang) {
+                    handle_mnt_translate_batch_finished(
+                        in_lang, std::move(out_texts), out_lang);
+                },
                 /*state_changed=*/
                 [this](mnt_engine::state_t state) {
                     if (m_current_task) {
@@ -1511,12 +1877,85 @@ void speech_service::handle_stt_intermediate_text_decoded(
     }
 }
 
-void speech_service::handle_stt_text_decoded(const QString &, const QString &,
-                                             int task_id) {
+void speech_service::handle_stt_text_decoded(const QString &text,
+                                             const QString &, int task_id) {
     if (m_current_task && m_current_task->id == task_id &&
         m_current_task->speech_mode == speech_mode_t::single_sentence) {
         stt_stop_listen(m_current_task->id);
     }
+
+    // next sentence is being decoded while this one is translated
+    if (interpreting(task_id) && m_mnt_engine && !text.trimmed().isEmpty()) {
+        ++m_interpret_pending;
+        m_mnt_engine->translate(text.toStdString());
+    }
+}
+
+void speech_service::handle_interpret_translated(const QString &out_text,
+                                                 int task_id) {
+    if (!interpreting(task_id) || current_task_id() != task_id) return;
+
+    if (m_tts_engine && !out_text.trimmed().isEmpty()) {
+        m_tts_engine->encode_speech(out_text.toStdString());
+    } else {
+        --m_interpret_pending;
+        finish_interpret_if_drained();
+    }
+}
+
+bool speech_service::interpreting(int task_id) const {
+    return m_interpret_task && *m_interpret_task == task_id;
+}
+
+void speech_service::reset_interpret() {
+    m_interpret_task.reset();
+    m_interpret_pending = 0;
+    m_interpret_draining = false;
+}
+
+void speech_service::drain_interpret() {
+    qDebug() << "draining interpret:" << *m_interpret_task
+             << "pending:" << m_interpret_pending;
+
+    // mic is closed but sentences already decoded are still translated
+    // and spoken, task ends when the last one is played
+    m_interpret_draining = true;
+
+    if (m_stt_engine) m_stt_engine->stop();
+    {
+        std::lock_guard lock{m_stt_preview_mtx};
+        if (m_stt_preview_engine) m_stt_preview_engine->stop();
+    }
+
+    restart_audio_source();
+
+    finish_interpret_if_drained();
+}
+
+void speech_service::finish_interpret_if_drained() {
+    if (!m_interpret_draining || m_interpret_pending > 0 ||
+        !m_tts_queue.empty() ||
+        m_player.state() != QMediaPlayer::State::StoppedState)
+        return;
+
+    qDebug() << "interpret drained";
+
+    stop_stt_engine();
+}
+
+void speech_service::stop_interpret() {
+    if (!m_interpret_task) return;
+
+    qDebug() << "stop interpret:" << *m_interpret_task;
+
+    reset_interpret();
+
+    if (m_mnt_engine) m_mnt_engine->stop();
+    if (m_tts_engine) m_tts_engine->stop();
+
+    clean_tts_queue();
+
+    m_player.stop();
 }
 
 void speech_service::handle_stt_sentence_timeout(int task_id) {
@@ -1534,6 +1973,12 @@ void speech_service::handle_stt_engine_eof(int task_id) {
     qDebug() << "engine eof";
     if (audio_source_type() == source_t::file)
         emit stt_file_transcribe_finished(task_id);
+
+    if (interpreting(task_id) && current_task_id() == task_id) {
+        drain_interpret();
+        return;
+    }
+
     cancel(task_id);
 }
 
@@ -1548,6 +1993,7 @@ void speech_service::handle_stt_engine_error(int task_id) {
 
     if (current_task_id() == task_id) {
         cancel(task_id);
+        stop_stt_preview_engine();
         if (m_stt_engine) {
             m_stt_engine.reset();
             qDebug() << "stt engine destroyed successfully";
@@ -1585,7 +2031,8 @@ void speech_service::handle_mnt_engine_state_changed(mnt_engine::state_t state,
 
     if ((state == mnt_engine::state_t::idle ||
          state == mnt_engine::state_t::error) &&
-        m_current_task && m_current_task->id == task_id) {
+        m_current_task && m_current_task->id == task_id &&
+        !interpreting(task_id)) {
         stop_mnt_engine();
     }
 
@@ -1603,6 +2050,22 @@ void speech_service::handle_mnt_translate_finished(
     }
 }
 
+void speech_service::handle_mnt_translate_batch_finished(
+    const std::string &in_lang, std::vector<std::string> &&out_texts,
+    const std::string &out_lang) {
+    if (m_current_task) {
+        QStringList texts;
+        texts.reserve(static_cast<int>(out_texts.size()));
+        for (const auto &text : out_texts)
+            texts.push_back(QString::fromStdString(text));
+
+        emit mnt_translate_batch_finished(QString::fromStdString(in_lang),
+                                          texts,
+                                          QString::fromStdString(out_lang),
+                                          m_current_task->id);
+    }
+}
+
 void speech_service::handle_tts_speech_encoded(
     const std::string &text, const std::string &audio_file_path,
     tts_engine::audio_format_t format, bool last) {
@@ -1768,7 +2231,15 @@ void speech_service::handle_speech_to_file(const tts_partial_result_t &result) {
 
 void speech_service::handle_tts_speech_encoded(tts_partial_result_t result) {
     if (m_current_task && m_current_task->id == result.task_id) {
-        if (m_current_task->speech_mode == speech_mode_t::play_speech) {
+        if (interpreting(result.task_id)) {
+            // each sentence is a separate tts task, playback ends with
+            // the stt task
+            if (result.last) --m_interpret_pending;
+            result.last = false;
+            m_tts_queue.push(std::move(result));
+            handle_tts_queue();
+            finish_interpret_if_drained();
+        } else if (m_current_task->speech_mode == speech_mode_t::play_speech) {
             m_tts_queue.push(std::move(result));
             handle_tts_queue();
         } else {
@@ -1852,6 +2323,12 @@ void speech_service::handle_mnt_engine_error(int task_id) {
 }
 
 void speech_service::handle_stt_text_decoded(const std::string &text) {
+    {
+        // preview of the next utterance starts from scratch
+        std::lock_guard lock{m_stt_preview_mtx};
+        if (m_stt_preview_engine) m_stt_preview_engine->restart();
+    }
+
     if (m_current_task) {
         if (m_previous_task &&
             m_last_intermediate_text_task == m_previous_task->id) {
@@ -1881,8 +2358,9 @@ void speech_service::handle_player_state_changed(
     update_task_state();
 
     if (new_state == QMediaPlayer::State::StoppedState && m_current_task &&
-        m_current_task->engine == engine_t::tts && !m_current_task->paused &&
-        !m_tts_queue.empty()) {
+        (m_current_task->engine == engine_t::tts ||
+         interpreting(m_current_task->id)) &&
+        !m_current_task->paused && !m_tts_queue.empty()) {
         const auto &result = m_tts_queue.front();
 
         auto task = result.task_id;
@@ -1908,6 +2386,9 @@ void speech_service::handle_player_state_changed(
 
         handle_tts_queue();
     }
+
+    if (new_state == QMediaPlayer::State::StoppedState)
+        finish_interpret_if_drained();
 }
 
 QVariantMap speech_service::available_models(
@@ -1931,7 +2412,8 @@ QVariantMap speech_service::available_langs(
     const std::map<QString, model_data_t> &available_models_map) const {
     QVariantMap map;
 
-    auto langs_map = models_manager::instance()->available_langs_map();
+    const auto catalog = models_manager::instance()->catalog();
+    const auto &langs_map = catalog->available_langs_map;
 
     std::for_each(
         available_models_map.cbegin(), available_models_map.cend(),
@@ -1961,7 +2443,8 @@ QVariantMap speech_service::available_trg_langs(
     const std::map<QString, model_data_t> &available_models_map) const {
     QVariantMap map;
 
-    auto langs_map = models_manager::instance()->langs_map();
+    const auto catalog = models_manager::instance()->catalog();
+    const auto &langs_map = catalog->langs_map;
 
     std::for_each(
         available_models_map.cbegin(), available_models_map.cend(),
@@ -1991,7 +2474,8 @@ QVariantList speech_service::available_lang_list(
     const std::map<QString, model_data_t> &available_models_map) const {
     QVariantList list;
 
-    auto all_langs = models_manager::instance()->langs();
+    const auto catalog = models_manager::instance()->catalog();
+    const auto &all_langs = catalog->langs;
 
     std::set<QString> available_langs;
 
@@ -2054,7 +2538,8 @@ QVariantList speech_service::available_stt_tts_lang_list() const {
 
     if (stt_langs.empty()) return list;
 
-    auto all_langs = models_manager::instance()->langs();
+    const auto catalog = models_manager::instance()->catalog();
+    const auto &all_langs = catalog->langs;
 
     list.reserve(stt_tts_langs.size());
 
@@ -2125,6 +2610,13 @@ void speech_service::delete_model(const QString &id) {
 }
 
 void speech_service::handle_audio_available() {
+    // translated speech picked up by mic would be interpreted again
+    if (m_source && m_current_task && interpreting(m_current_task->id) &&
+        m_player.state() == QMediaPlayer::State::PlayingState) {
+        m_source->clear();
+        return;
+    }
+
     if (m_source && m_stt_engine && m_stt_engine->started()) {
         if (m_stt_engine->speech_detection_status() ==
             stt_engine::speech_detection_status_t::initializing) {
@@ -2361,7 +2853,8 @@ int speech_service::next_task_id() {
 }
 
 int speech_service::stt_transcribe_file(const QString &file, QString lang,
-                                        QString out_lang) {
+                                        QString out_lang,
+                                        const QVariantMap &options) {
     if (state() == state_t::unknown || state() == state_t::not_configured ||
         state() == state_t::busy) {
         qWarning() << "cannot transcribe_file, invalid state";
@@ -2386,12 +2879,16 @@ int speech_service::stt_transcribe_file(const QString &file, QString lang,
     m_current_task = {
         next_task_id(),
         engine_t::stt,
-        restart_stt_engine(speech_mode_t::automatic, lang, out_lang),
+        restart_stt_engine(
+            speech_mode_t::automatic, lang, out_lang,
+            stt_decoding_profile_from_options(
+                options, settings::instance()->stt_file_decoding_profile()),
+            /*file_source=*/true),
         speech_mode_t::automatic,
         out_lang,
         {},
         {},
-        {},
+        options,
         false};
 
     if (m_current_task->model_id.isEmpty()) {
@@ -2438,6 +2935,29 @@ int speech_service::stt_transcribe_file(const QString &file, QString lang,
 int speech_service::mnt_translate(const QString &text, QString lang,
                                   QString out_lang,
                                   const QVariantMap &options) {
+    qDebug() << "mnt translate";
+
+    return start_mnt_task(std::move(lang), std::move(out_lang), options,
+                          [&](mnt_engine &engine) {
+                              engine.translate(text.toStdString());
+                          });
+}
+
+int speech_service::mnt_translate_batch(const QStringList &texts,
+                                        QString lang, QString out_lang,
+                                        const QVariantMap &options) {
+    qDebug() << "mnt translate batch:" << texts.size();
+
+    return start_mnt_task(
+        std::move(lang), std::move(out_lang), options,
+        [&](mnt_engine &engine) {
+            engine.translate_batch(mnt_batch_items_from_texts(texts, options));
+        });
+}
+
+int speech_service::start_mnt_task(
+    QString lang, QString out_lang, const QVariantMap &options,
+    const std::function<void(mnt_engine &)> &push_task) {
     if (state() == state_t::unknown || state() == state_t::not_configured ||
         state() == state_t::busy) {
         qWarning() << "cannot mnt translate, invalid state";
@@ -2454,8 +2974,6 @@ int speech_service::mnt_translate(const QString &text, QString lang,
             tts_stop_speech(m_current_task->id);
     }
 
-    qDebug() << "mnt translate";
-
     m_current_task = {next_task_id(),
                       engine_t::mnt,
                       restart_mnt_engine(lang, out_lang, options),
@@ -2478,7 +2996,7 @@ int speech_service::mnt_translate(const QString &text, QString lang,
         return INVALID_TASK;
     }
 
-    if (m_mnt_engine) m_mnt_engine->translate(text.toStdString());
+    if (m_mnt_engine) push_task(*m_mnt_engine);
 
     start_keepalive_current_task();
 
@@ -2489,8 +3007,37 @@ int speech_service::mnt_translate(const QString &text, QString lang,
     return m_current_task->id;
 }
 
+int speech_service::stt_start_interpret(QString lang, QString out_lang,
+                                        const QVariantMap &options) {
+    if (out_lang.contains('-')) out_lang = out_lang.split('-').first();
+
+    auto task = stt_start_listen(speech_mode_t::automatic, lang, {}, options);
+    if (task == INVALID_TASK || !m_current_task) return INVALID_TASK;
+
+    qDebug() << "stt start interpret";
+
+    auto it = m_available_stt_models_map.find(m_current_task->model_id);
+    auto in_lang =
+        it == m_available_stt_models_map.cend() ? lang : it->second.lang_id;
+
+    // all three engines stay loaded, so decoding, translation and synthesis
+    // of consecutive sentences run concurrently
+    if (restart_mnt_engine(in_lang, out_lang, options).isEmpty() ||
+        restart_tts_engine(out_lang, options).isEmpty()) {
+        qWarning() << "failed to start interpret, no models for:" << in_lang
+                   << out_lang;
+        cancel(task);
+        return INVALID_TASK;
+    }
+
+    m_interpret_task = task;
+
+    return task;
+}
+
 int speech_service::stt_start_listen(speech_mode_t mode, QString lang,
-                                     QString out_lang) {
+                                     QString out_lang,
+                                     const QVariantMap &options) {
     if (state() == state_t::unknown || state() == state_t::not_configured ||
         state() == state_t::busy) {
         qWarning() << "cannot stt start listen, invalid state";
@@ -2519,20 +3066,31 @@ int speech_service::stt_start_listen(speech_mode_t mode, QString lang,
 
     if (set_pending_stt_task) {
         qDebug() << "setting pending stt task";
-        m_pending_task = {
-            next_task_id(), engine_t::stt, lang, mode, out_lang, {}, {}, {}};
+        m_pending_task = {next_task_id(),
+                          engine_t::stt,
+                          lang,
+                          mode,
+                          out_lang,
+                          {},
+                          {},
+                          options};
         return m_pending_task->id;
     }
 
-    m_current_task = {next_task_id(),
-                      engine_t::stt,
-                      restart_stt_engine(mode, lang, out_lang),
-                      mode,
-                      out_lang,
-                      {},
-                      {},
-                      {},
-                      false};
+    m_current_task = {
+        next_task_id(),
+        engine_t::stt,
+        restart_stt_engine(
+            mode, lang, out_lang,
+            stt_decoding_profile_from_options(
+                options, settings::instance()->stt_live_decoding_profile()),
+            /*file_source=*/false),
+        mode,
+        out_lang,
+        {},
+        {},
+        options,
+        false};
 
     if (m_current_task->model_id.isEmpty()) {
         m_current_task.reset();
@@ -2677,7 +3235,8 @@ int speech_service::tts_speech_to_file(const QString &text, QString lang,
         return INVALID_TASK;
     }
 
-    if (m_tts_engine) m_tts_engine->encode_speech(text.toStdString());
+    if (m_tts_engine)
+        m_tts_engine->encode_speech(text.toStdString(), /*offline=*/true);
 
     start_keepalive_current_task();
 
@@ -2688,6 +3247,32 @@ int speech_service::tts_speech_to_file(const QString &text, QString lang,
     return m_current_task->id;
 }
 
+int speech_service::tts_prerender_speech(const QString &text, QString lang,
+                                         const QVariantMap &options) {
+    // prerendering must not interrupt anything the user has requested
+    if (state() != state_t::idle || m_current_task) {
+        qDebug() << "tts prerender skipped, service is not idle";
+        return FAILURE;
+    }
+
+    if (text.isEmpty()) return FAILURE;
+
+    if (lang.contains('-')) lang = lang.split('-').first();
+
+    qDebug() << "tts prerender speech";
+
+    if (restart_tts_engine(lang, options).isEmpty() || !m_tts_engine) {
+        qWarning() << "failed to restart engine";
+        return FAILURE;
+    }
+
+    m_tts_engine->prerender_speech(text.toStdString());
+
+    m_tts_prerender_active = true;
+
+    return SUCCESS;
+}
+
 int speech_service::cancel(int task) {
     if (state() == state_t::unknown) {
         qWarning() << "cannot cancel, invalid state";
@@ -2718,8 +3303,12 @@ int speech_service::cancel(int task) {
 
         if (m_pending_task->engine == engine_t::stt) {
             if (m_current_task->engine == engine_t::tts) stop_tts_engine();
-            restart_stt_engine(next_task.speech_mode, next_task.model_id,
-                               next_task.out_lang);
+            restart_stt_engine(
+                next_task.speech_mode, next_task.model_id, next_task.out_lang,
+                stt_decoding_profile_from_options(
+                    next_task.options,
+                    settings::instance()->stt_live_decoding_profile()),
+                /*file_source=*/false);
         } else if (next_task.engine == engine_t::tts) {
             if (m_current_task->engine == engine_t::stt) stop_stt_engine();
             restart_tts_engine(m_pending_task->model_id, {});
@@ -2923,7 +3512,13 @@ void speech_service::stop_tts_engine() {
 void speech_service::stop_stt_engine() {
     qDebug() << "stop stt engine";
 
+    stop_interpret();
+
     if (m_stt_engine) m_stt_engine->stop();
+    {
+        std::lock_guard lock{m_stt_preview_mtx};
+        if (m_stt_preview_engine) m_stt_preview_engine->stop();
+    }
 
     restart_audio_source();
 
@@ -2986,10 +3581,13 @@ void speech_service::restart_audio_source(const QString &source_file) {
         if (m_source) m_source->disconnect();
 
         if (source_file.isEmpty())
-            m_source = std::make_unique<mic_source>();
+            m_source = std::make_unique<mic_source>(low_power());
         else
             m_source = std::make_unique<file_source>(source_file);
 
+        // file is processed in large chunks regardless of the setting
+        m_stt_engine->set_low_latency(source_file.isEmpty() && low_latency());
+
         set_progress(m_source->progress());
         connect(m_source.get(), &audio_source::audio_available, this,
                 &speech_service::handle_audio_available, Qt::QueuedConnection);
@@ -3314,6 +3912,78 @@ void speech_service::set_default_mnt_out_lang(const QString &lang_id) const {
         test_default_mnt_out_lang(lang_id));
 }
 
+void speech_service::update_performance_profile() {
+    auto profile = settings::instance()->performance_profile();
+
+    if (profile == settings::performance_profile_t::PerformanceProfileAuto) {
+        auto on_battery = power_tools::power_source() ==
+                          power_tools::power_source_t::battery;
+        auto throttled = power_tools::thermal_throttled();
+
+        profile =
+            on_battery || throttled
+                ? settings::performance_profile_t::PerformanceProfilePowerSaver
+                : settings::performance_profile_t::PerformanceProfileBalanced;
+
+        if (profile != m_performance_profile)
+            qDebug() << "power state: battery =" << on_battery
+                     << ", thermal throttled =" << throttled;
+    }
+
+    if (profile == m_performance_profile) return;
+
+    qDebug() << "performance profile:" << m_performance_profile << "=>"
+             << profile;
+
+    m_performance_profile = profile;
+
+    // running engines pick up threads and decoding profile on next
+    // restart, only live audio settings can be changed immediately
+    if (m_stt_engine && m_source &&
+        m_source->type() == audio_source::source_type::mic)
+        m_stt_engine->set_low_latency(low_latency());
+}
+
+bool speech_service::low_latency() const {
+    return settings::instance()->stt_low_latency() && !low_power();
+}
+
+unsigned int speech_service::engine_num_threads() const {
+    auto num_threads = settings::instance()->effective_num_threads();
+
+    switch (m_performance_profile) {
+        case settings::performance_profile_t::PerformanceProfilePowerSaver: {
+            auto limit = std::max(1U, std::thread::hardware_concurrency() / 4);
+            return num_threads > 0 ? std::min(num_threads, limit) : limit;
+        }
+        case settings::performance_profile_t::PerformanceProfileMaxThroughput:
+            return num_threads > 0
+                       ? num_threads
+                       : std::max(1U, std::thread::hardware_concurrency());
+        case settings::performance_profile_t::PerformanceProfileAuto:
+        case settings::performance_profile_t::PerformanceProfileBalanced:
+            break;
+    }
+
+    return num_threads;
+}
+
+int speech_service::dbus_performance_profile() const {
+    return static_cast<int>(settings::instance()->performance_profile());
+}
+
+void speech_service::set_dbus_performance_profile(int profile) const {
+    if (profile < 0 ||
+        profile > static_cast<int>(settings::performance_profile_t::
+                                       PerformanceProfileMaxThroughput)) {
+        qWarning() << "invalid performance profile:" << profile;
+        return;
+    }
+
+    settings::instance()->set_performance_profile(
+        static_cast<settings::performance_profile_t>(profile));
+}
+
 void speech_service::set_default_tts_model(const QString &model_id) const {
     if (test_default_tts_model(model_id) == model_id) {
         settings::instance()->set_default_tts_model(model_id);
@@ -3449,7 +4119,40 @@ int speech_service::SttStartListen(int mode, const QString &lang,
         return INVALID_TASK;
     }
 
-    return stt_start_listen(speech_mode, lang, out_lang);
+    return stt_start_listen(speech_mode, lang, out_lang, {});
+}
+
+int speech_service::SttStartListen2(int mode, const QString &lang,
+                                    const QString &out_lang,
+                                    const QVariantMap &options) {
+    qDebug() << "[dbus => service] called StartListen2:" << lang << mode
+             << out_lang;
+    m_keepalive_timer.start();
+
+    speech_mode_t speech_mode;
+
+    if (mode == 0)
+        speech_mode = speech_mode_t::automatic;
+    else if (mode == 1)
+        speech_mode = speech_mode_t::manual;
+    else if (mode == 2)
+        speech_mode = speech_mode_t::single_sentence;
+    else {
+        qWarning() << "invalid speech mode";
+        return INVALID_TASK;
+    }
+
+    return stt_start_listen(speech_mode, lang, out_lang, options);
+}
+
+int speech_service::SttStartInterpret(const QString &lang,
+                                      const QString &out_lang,
+                                      const QVariantMap &options) {
+    qDebug() << "[dbus => service] called SttStartInterpret:" << lang
+             << out_lang;
+    m_keepalive_timer.start();
+
+    return stt_start_interpret(lang, out_lang, options);
 }
 
 int speech_service::SttStopListen(int task) {
@@ -3472,7 +4175,18 @@ int speech_service::SttTranscribeFile(const QString &file, const QString &lang,
              << out_lang;
     start_keepalive_current_task();
 
-    return stt_transcribe_file(file, lang, out_lang);
+    return stt_transcribe_file(file, lang, out_lang, {});
+}
+
+int speech_service::SttTranscribeFile2(const QString &file,
+                                       const QString &lang,
+                                       const QString &out_lang,
+                                       const QVariantMap &options) {
+    qDebug() << "[dbus => service] called TranscribeFile2:" << file << lang
+             << out_lang;
+    start_keepalive_current_task();
+
+    return stt_transcribe_file(file, lang, out_lang, options);
 }
 
 double speech_service::SttGetFileTranscribeProgress(int task) {
@@ -3530,6 +4244,54 @@ int speech_service::TtsSpeechToFile(const QString &text, const QString &lang,
     return tts_speech_to_file(text, lang, options);
 }
 
+static std::optional<QString> text_from_fd(const QDBusUnixFileDescriptor &fd) {
+    if (!fd.isValid()) {
+        qWarning() << "invalid text fd";
+        return std::nullopt;
+    }
+
+    auto text = fd_tools::read_text(fd.fileDescriptor());
+    if (!text) {
+        qWarning() << "failed to read text from fd, not a file or too large";
+        return std::nullopt;
+    }
+
+    return QString::fromStdString(*text);
+}
+
+int speech_service::TtsPlaySpeechFd(const QDBusUnixFileDescriptor &text,
+                                    const QString &lang,
+                                    const QVariantMap &options) {
+    qDebug() << "[dbus => service] called TtsPlaySpeechFd:" << lang;
+    start_keepalive_current_task();
+
+    auto in_text = text_from_fd(text);
+    if (!in_text) return INVALID_TASK;
+
+    return tts_play_speech(*in_text, lang, options);
+}
+
+int speech_service::TtsPrerenderSpeech(const QString &text,
+                                       const QString &lang,
+                                       const QVariantMap &options) {
+    qDebug() << "[dbus => service] called TtsPrerenderSpeech:" << lang;
+    m_keepalive_timer.start();
+
+    return tts_prerender_speech(text, lang, options);
+}
+
+int speech_service::TtsSpeechToFileFd(const QDBusUnixFileDescriptor &text,
+                                      const QString &lang,
+                                      const QVariantMap &options) {
+    qDebug() << "[dbus => service] called TtsSpeechToFileFd:" << lang;
+    start_keepalive_current_task();
+
+    auto in_text = text_from_fd(text);
+    if (!in_text) return INVALID_TASK;
+
+    return tts_speech_to_file(*in_text, lang, options);
+}
+
 double speech_service::TtsGetSpeechToFileProgress(int task) {
     qDebug() << "[dbus => service] called TtsGetSpeechToFileProgress:" << task;
     start_keepalive_current_task();
@@ -3575,6 +4337,31 @@ int speech_service::MntTranslate2(const QString &text, const QString &lang,
     return mnt_translate(text, lang, out_lang, options);
 }
 
+int speech_service::MntTranslateBatch(const QStringList &texts,
+                                      const QString &lang,
+                                      const QString &out_lang,
+                                      const QVariantMap &options) {
+    qDebug() << "[dbus => service] called MntTranslateBatch:" << texts.size();
+    start_keepalive_current_task();
+
+    return mnt_translate_batch(texts, lang, out_lang, options);
+}
+
+int speech_service::MntTranslateFd(const QDBusUnixFileDescriptor &text,
+                                   const QString &lang, const QString &out_lang,
+                                   const QVariantMap &options) {
+    qDebug() << "[dbus => service] called MntTranslateFd";
+    start_keepalive_current_task();
+
+    auto in_text = text_from_fd(text);
+    if (!in_text) return INVALID_TASK;
+
+    auto task = mnt_translate(*in_text, lang, out_lang, options);
+    if (task != INVALID_TASK) m_fd_result_task = task;
+
+    return task;
+}
+
 QVariantMap speech_service::MntGetOutLangs(const QString &lang) {
     qDebug() << "[dbus => service] called MntGetOutLangs";
     return mnt_out_langs(lang);
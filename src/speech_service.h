@@ -8,6 +8,7 @@
 #ifndef SPEECH_SERVICE_H
 #define SPEECH_SERVICE_H
 
+#include <QDBusUnixFileDescriptor>
 #include <QDebug>
 #include <QIODevice>
 #include <QMediaPlayer>
@@ -17,6 +18,7 @@
 #include <QVariantList>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <queue>
 #include <set>
@@ -29,6 +31,7 @@
 #include "dbus_speech_adaptor.h"
 #include "mnt_engine.hpp"
 #include "models_manager.h"
+#include "settings.h"
 #include "singleton.h"
 #include "stt_engine.hpp"
 #include "tts_engine.hpp"
@@ -67,6 +70,8 @@ class speech_service : public QObject, public singleton<speech_service> {
     Q_PROPERTY(QString DefaultTtsModel READ default_tts_model WRITE
                    set_default_tts_model)
     Q_PROPERTY(int CurrentTask READ current_task_id CONSTANT)
+    Q_PROPERTY(int PerformanceProfile READ dbus_performance_profile WRITE
+                   set_dbus_performance_profile)
     Q_PROPERTY(QVariantMap Translations READ translations CONSTANT)
 
    public:
@@ -122,10 +127,14 @@ class speech_service : public QObject, public singleton<speech_service> {
     Q_INVOKABLE void delete_model(const QString &id);
 
     Q_INVOKABLE int stt_start_listen(speech_service::speech_mode_t mode,
-                                     QString lang, QString out_lang);
+                                     QString lang, QString out_lang,
+                                     const QVariantMap &options);
+    Q_INVOKABLE int stt_start_interpret(QString lang, QString out_lang,
+                                        const QVariantMap &options);
     Q_INVOKABLE int stt_stop_listen(int task);
     Q_INVOKABLE int stt_transcribe_file(const QString &file, QString lang,
-                                        QString out_lang);
+                                        QString out_lang,
+                                        const QVariantMap &options);
     Q_INVOKABLE int tts_play_speech(const QString &text, QString lang,
                                     const QVariantMap &options);
     Q_INVOKABLE int tts_pause_speech(int task);
@@ -133,9 +142,14 @@ class speech_service : public QObject, public singleton<speech_service> {
     Q_INVOKABLE int tts_stop_speech(int task);
     Q_INVOKABLE int tts_speech_to_file(const QString &text, QString lang,
                                        const QVariantMap &options);
+    Q_INVOKABLE int tts_prerender_speech(const QString &text, QString lang,
+                                         const QVariantMap &options);
 
     Q_INVOKABLE int mnt_translate(const QString &text, QString lang,
                                   QString out_lang, const QVariantMap &options);
+    Q_INVOKABLE int mnt_translate_batch(const QStringList &texts, QString lang,
+                                        QString out_lang,
+                                        const QVariantMap &options);
     Q_INVOKABLE int cancel(int task);
 
     QString default_stt_model() const;
@@ -155,6 +169,7 @@ class speech_service : public QObject, public singleton<speech_service> {
     QVariantMap available_mnt_langs() const;
     void set_default_mnt_lang(const QString &lang_id) const;
     void set_default_mnt_out_lang(const QString &lang_id) const;
+    inline auto performance_profile() const { return m_performance_profile; }
     QString default_tts_model() const;
     QString default_tts_lang() const;
     void set_default_tts_model(const QString &model_id) const;
@@ -193,6 +208,9 @@ class speech_service : public QObject, public singleton<speech_service> {
     void mnt_translate_finished(const QString &in_text, const QString &in_lang,
                                 const QString &out_text,
                                 const QString &out_lang, int task);
+    void mnt_translate_batch_finished(const QString &in_lang,
+                                      const QStringList &out_texts,
+                                      const QString &out_lang, int task);
     void requet_update_task_state();
     void mnt_engine_state_changed(mnt_engine::state_t state, int task_id);
     void current_task_changed();
@@ -241,9 +259,16 @@ class speech_service : public QObject, public singleton<speech_service> {
     void MntLangListPropertyChanged(const QVariantList &langs);
     void DefaultMntLangPropertyChanged(const QString &lang);
     void DefaultMntOutLangPropertyChanged(const QString &lang);
+    void PerformanceProfilePropertyChanged(int profile);
     void MntTranslateFinished(const QString &in_text, const QString &in_lang,
                               const QString &out_text, const QString &out_lang,
                               int task);
+    void MntTranslateBatchFinished(const QString &in_lang,
+                                   const QStringList &out_texts,
+                                   const QString &out_lang, int task);
+    void MntTranslateFdFinished(const QDBusUnixFileDescriptor &out_text,
+                                const QString &in_lang,
+                                const QString &out_lang, int task);
     void FeaturesAvailabilityUpdated();
 
    private:
@@ -344,9 +369,12 @@ class speech_service : public QObject, public singleton<speech_service> {
     static const int KEEPALIVE_TIME = 60000;           // 60s
     static const int KEEPALIVE_TASK_TIME = 10000;      // 10s
     static const int SINGLE_SENTENCE_TIMEOUT = 10000;  // 10s
+    static const int POWER_STATE_CHECK_TIME = 30000;   // 30s
 
     int m_last_task_id = INVALID_TASK;
     std::unique_ptr<stt_engine> m_stt_engine;
+    std::unique_ptr<stt_engine> m_stt_preview_engine;
+    std::mutex m_stt_preview_mtx;
     std::unique_ptr<tts_engine> m_tts_engine;
     std::unique_ptr<mnt_engine> m_mnt_engine;
     std::unique_ptr<audio_source> m_source;
@@ -366,10 +394,24 @@ class speech_service : public QObject, public singleton<speech_service> {
     QTimer m_keepalive_timer;
     QTimer m_keepalive_current_task_timer;
     QTimer m_features_availability_timer;
+    QTimer m_power_state_timer;
+    // profile resolved from settings and power state, never auto
+    settings::performance_profile_t m_performance_profile =
+        settings::performance_profile_t::PerformanceProfileBalanced;
     int m_last_intermediate_text_task = INVALID_TASK;
+    // mnt task which result is returned in memfd
+    int m_fd_result_task = INVALID_TASK;
     std::optional<task_t> m_previous_task;
     std::optional<task_t> m_current_task;
     std::optional<task_t> m_pending_task;
+    // tts engine is synthesizing speech into cache without a task
+    bool m_tts_prerender_active = false;
+    // stt task whose decoded sentences are translated and spoken
+    std::optional<int> m_interpret_task;
+    // sentences sent to mnt whose speech is not encoded yet
+    int m_interpret_pending = 0;
+    // stt is stopped, task waits for pending sentences to be played
+    bool m_interpret_draining = false;
     QMediaPlayer m_player;
     int m_task_state = 0;
     std::queue<tts_partial_result_t> m_tts_queue;
@@ -398,9 +440,18 @@ class speech_service : public QObject, public singleton<speech_service> {
                                        const std::string &in_lang,
                                        std::string &&out_text,
                                        const std::string &out_lang);
+    void handle_mnt_translate_batch_finished(
+        const std::string &in_lang, std::vector<std::string> &&out_texts,
+        const std::string &out_lang);
     void handle_stt_text_decoded(const std::string &text);
     void handle_stt_text_decoded(const QString &text, const QString &model_id,
                                  int task_id);
+    void handle_interpret_translated(const QString &out_text, int task_id);
+    bool interpreting(int task_id) const;
+    void stop_interpret();
+    void reset_interpret();
+    void drain_interpret();
+    void finish_interpret_if_drained();
     void handle_stt_intermediate_text_decoded(const std::string &text);
     void handle_tts_speech_encoded(const std::string &text,
                                    const std::string &audio_file_path,
@@ -415,11 +466,29 @@ class speech_service : public QObject, public singleton<speech_service> {
     void handle_processing_changed(bool processing);
     void handle_audio_error();
     void handle_audio_ended();
-    QString restart_stt_engine(speech_mode_t speech_mode,
-                               const QString &model_id,
-                               const QString &out_lang_id);
+    QString restart_stt_engine(
+        speech_mode_t speech_mode, const QString &model_id,
+        const QString &out_lang_id,
+        stt_engine::decoding_profile_t decoding_profile, bool file_source);
+    void restart_stt_preview_engine(const stt_model_config_t &main_config);
+    void update_performance_profile();
+    inline bool low_power() const {
+        return m_performance_profile ==
+               settings::performance_profile_t::PerformanceProfilePowerSaver;
+    }
+    bool low_latency() const;
+    unsigned int engine_num_threads() const;
+    int dbus_performance_profile() const;
+    void set_dbus_performance_profile(int profile) const;
+    void stop_stt_preview_engine();
+    std::optional<stt_model_config_t> choose_stt_preview_model_config(
+        const QString &lang_id) const;
     QString restart_tts_engine(const QString &model_id,
                                const QVariantMap &options);
+    void cancel_tts_prerender();
+    int start_mnt_task(QString lang, QString out_lang,
+                       const QVariantMap &options,
+                       const std::function<void(mnt_engine &)> &push_task);
     QString restart_mnt_engine(const QString &model_or_lang_id,
                                const QString &out_lang_id,
                                const QVariantMap &options);
@@ -459,6 +528,7 @@ class speech_service : public QObject, public singleton<speech_service> {
     void handle_task_timeout();
     QVariantMap translations() const;
     static QString lang_from_model_id(const QString &model_id);
+    static text_tools::nb_splitter_t nb_splitter_for_lang(const QString &lang);
     int dbus_state() const;
     void start_keepalive_current_task();
     void stop_keepalive_current_task();
@@ -499,9 +569,19 @@ class speech_service : public QObject, public singleton<speech_service> {
     Q_INVOKABLE int Reload();
     Q_INVOKABLE int SttStartListen(int mode, const QString &lang,
                                    const QString &out_lang);
+    Q_INVOKABLE int SttStartListen2(int mode, const QString &lang,
+                                    const QString &out_lang,
+                                    const QVariantMap &options);
+    Q_INVOKABLE int SttStartInterpret(const QString &lang,
+                                      const QString &out_lang,
+                                      const QVariantMap &options);
     Q_INVOKABLE int SttStopListen(int task);
     Q_INVOKABLE int SttTranscribeFile(const QString &file, const QString &lang,
                                       const QString &out_lang);
+    Q_INVOKABLE int SttTranscribeFile2(const QString &file,
+                                       const QString &lang,
+                                       const QString &out_lang,
+                                       const QVariantMap &options);
     Q_INVOKABLE double SttGetFileTranscribeProgress(int task);
     Q_INVOKABLE int TtsPlaySpeech(const QString &text, const QString &lang);
     Q_INVOKABLE int TtsPlaySpeech2(const QString &text, const QString &lang,
@@ -511,12 +591,27 @@ class speech_service : public QObject, public singleton<speech_service> {
     Q_INVOKABLE int TtsStopSpeech(int task);
     Q_INVOKABLE int TtsSpeechToFile(const QString &text, const QString &lang,
                                     const QVariantMap &options);
+    Q_INVOKABLE int TtsPlaySpeechFd(const QDBusUnixFileDescriptor &text,
+                                    const QString &lang,
+                                    const QVariantMap &options);
+    Q_INVOKABLE int TtsPrerenderSpeech(const QString &text, const QString &lang,
+                                       const QVariantMap &options);
+    Q_INVOKABLE int TtsSpeechToFileFd(const QDBusUnixFileDescriptor &text,
+                                      const QString &lang,
+                                      const QVariantMap &options);
     Q_INVOKABLE double TtsGetSpeechToFileProgress(int task);
     Q_INVOKABLE int MntTranslate(const QString &text, const QString &lang,
                                  const QString &out_lang);
     Q_INVOKABLE int MntTranslate2(const QString &text, const QString &lang,
                                   const QString &out_lang,
                                   const QVariantMap &options);
+    Q_INVOKABLE int MntTranslateBatch(const QStringList &texts,
+                                      const QString &lang,
+                                      const QString &out_lang,
+                                      const QVariantMap &options);
+    Q_INVOKABLE int MntTranslateFd(const QDBusUnixFileDescriptor &text,
+                                   const QString &lang, const QString &out_lang,
+                                   const QVariantMap &options);
     Q_INVOKABLE QVariantMap MntGetOutLangs(const QString &lang);
     Q_INVOKABLE QVariantMap FeaturesAvailability();
 };
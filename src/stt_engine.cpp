@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <ctime>
 #include <fstream>
 #include <iterator>
 #include <numeric>
@@ -156,6 +157,34 @@ std::ostream& operator<<(std::ostream& os, stt_engine::gpu_api_t api) {
     return os;
 }
 
+std::ostream& operator<<(std::ostream& os,
+                         stt_engine::decoding_profile_t profile) {
+    switch (profile) {
+        case stt_engine::decoding_profile_t::fast:
+            os << "fast";
+            break;
+        case stt_engine::decoding_profile_t::balanced:
+            os << "balanced";
+            break;
+        case stt_engine::decoding_profile_t::accurate:
+            os << "accurate";
+            break;
+    }
+
+    return os;
+}
+
+std::ostream& operator<<(std::ostream& os,
+                         const stt_engine::decoding_params_t& params) {
+    os << "beam-size=" << params.beam_size
+       << ", temperature-fallback=" << params.temperature_fallback
+       << ", use-context=" << params.use_context
+       << ", max-text-ctx=" << params.max_text_ctx
+       << ", threads=" << params.threads;
+
+    return os;
+}
+
 std::ostream& operator<<(std::ostream& os,
                          const stt_engine::model_files_t& model_files) {
     os << "model-file=" << model_files.model_file
@@ -180,6 +209,14 @@ std::ostream& operator<<(std::ostream& os, const stt_engine::config_t& config) {
        << "], speech-mode=" << config.speech_mode
        << ", vad-mode=" << config.vad_mode
        << ", speech-started=" << config.speech_started
+       << ", low-latency=" << config.low_latency
+       << ", native-endpointing=" << config.native_endpointing
+       << ", external-front-end=" << config.external_front_end
+       << ", vad-window-msec=" << config.vad_window_msec
+       << ", decoding-profile=" << config.decoding_profile
+       << ", file-source=" << config.file_source
+       << ", low-power=" << config.low_power
+       << ", num-threads=" << config.num_threads
        << ", options=" << config.options << ", use-gpu=" << config.use_gpu
        << ", gpu-device=[" << config.gpu_device << "]";
 
@@ -187,7 +224,11 @@ std::ostream& operator<<(std::ostream& os, const stt_engine::config_t& config) {
 }
 
 stt_engine::stt_engine(config_t config, callbacks_t call_backs)
-    : m_config{std::move(config)}, m_call_backs{std::move(call_backs)} {}
+    : m_config{std::move(config)},
+      m_call_backs{std::move(call_backs)},
+      m_low_latency_requested{m_config.low_latency} {
+    apply_low_latency();
+}
 
 stt_engine::~stt_engine() { LOGD("engine dtor"); }
 
@@ -261,9 +302,35 @@ void stt_engine::start_processing() {
             if (m_restart_requested) {
                 m_restart_requested = false;
                 flush(flush_t::restart);
+
+                if (m_config.external_front_end) {
+                    std::lock_guard front_end_lock{m_front_end_mtx};
+                    m_front_end_queue.clear();
+                    reset_in_processing();
+                }
+            }
+
+            if (m_config.low_latency != m_low_latency_requested) {
+                m_config.low_latency = m_low_latency_requested;
+                apply_low_latency();
             }
 
-            if (process_buff() == samples_process_result_t::wait_for_samples &&
+            auto process_start = std::chrono::steady_clock::now();
+            auto process_start_cpu = thread_cpu_time();
+
+            auto result = process_buff();
+
+            if (m_quantum_locked_size > 0) {
+                m_utterance_stats.samples += m_quantum_locked_size;
+                m_utterance_stats.cpu_time +=
+                    thread_cpu_time() - process_start_cpu;
+                update_processing_quantum(
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - process_start));
+                m_quantum_locked_size = 0;
+            }
+
+            if (result == samples_process_result_t::wait_for_samples &&
                 !m_thread_exit_requested)
                 m_processing_cv.wait(lock);
         }
@@ -345,14 +412,198 @@ bool stt_engine::lock_buff_for_processing() {
                                           << ", eof=" << m_in_buf.eof
                                           << ", buf size=" << m_in_buf.size);
 
-    if (!m_in_buf.eof && m_in_buf.size < m_in_buf_max_size) {
+    if (m_config.external_front_end) fill_in_buf_from_front_end();
+
+    if (!m_in_buf.eof && m_in_buf.size < processing_quantum()) {
         free_buf();
         return false;
     }
 
+    m_quantum_locked_size = m_in_buf.size;
+
     return true;
 }
 
+size_t stt_engine::processing_quantum() const {
+    // samples from external front-end contain only speech
+    if (m_config.external_front_end) return 1;
+
+    if (!m_config.low_latency) return m_in_buf_max_size;
+
+    if (m_speech_detection_status == speech_detection_status_t::speech_detected)
+        return m_quantum_size;
+
+    return m_quantum_idle_size;
+}
+
+void stt_engine::update_processing_quantum(
+    std::chrono::microseconds processing_dur) {
+    if (!m_config.low_latency) return;
+
+    auto audio_dur =
+        std::chrono::microseconds{m_quantum_locked_size * 1000000 /
+                                  m_sample_rate};
+
+    // grow quantum when engine is not keeping up with the audio,
+    // shrink it again when there is plenty of headroom
+    auto new_size = m_quantum_size;
+    if (processing_dur > audio_dur / 2)
+        new_size = std::min(2 * m_quantum_size, m_quantum_max_size);
+    else if (processing_dur < audio_dur / 8)
+        new_size = std::max(m_quantum_size / 2, m_quantum_min_size);
+
+    if (new_size != m_quantum_size) {
+        LOGD("processing quantum: " << m_quantum_size << " => " << new_size
+                                    << " (processing dur="
+                                    << processing_dur.count() / 1000
+                                    << "ms, audio dur="
+                                    << audio_dur.count() / 1000 << "ms)");
+        m_quantum_size = new_size;
+    }
+}
+
+void stt_engine::push_front_end_samples(const int16_t* data, size_t size) {
+    if (!m_config.external_front_end || m_thread_exit_requested) return;
+
+    {
+        std::lock_guard lock{m_front_end_mtx};
+
+        if (size > m_front_end_queue_max_size) {
+            data += size - m_front_end_queue_max_size;
+            size = m_front_end_queue_max_size;
+        }
+
+        auto new_size = m_front_end_queue.size() + size;
+        if (new_size > m_front_end_queue_max_size) {
+            auto drop_size = new_size - m_front_end_queue_max_size;
+            LOGW("front-end queue overflow, dropping samples: " << drop_size);
+            m_front_end_queue.erase(
+                m_front_end_queue.cbegin(),
+                std::next(m_front_end_queue.cbegin(), drop_size));
+        }
+
+        m_front_end_queue.insert(m_front_end_queue.end(), data, data + size);
+    }
+
+    m_processing_cv.notify_one();
+}
+
+void stt_engine::fill_in_buf_from_front_end() {
+    std::lock_guard lock{m_front_end_mtx};
+
+    auto size = std::min(m_front_end_queue.size(),
+                         m_in_buf.buf.size() - m_in_buf.size);
+    if (size == 0) return;
+
+    auto end = std::next(m_front_end_queue.cbegin(), size);
+    std::copy(m_front_end_queue.cbegin(), end,
+              std::next(m_in_buf.buf.begin(), m_in_buf.size));
+    m_front_end_queue.erase(m_front_end_queue.cbegin(), end);
+    m_in_buf.size += size;
+}
+
+void stt_engine::denoise_in_buf() {
+    if (m_config.external_front_end) return;
+
+    m_denoiser.process(m_in_buf.buf.data(), m_in_buf.size);
+}
+
+const vad::buf_t& stt_engine::remove_silence_from_in_buf() {
+    if (m_config.external_front_end) {
+        m_front_end_buf.assign(m_in_buf.buf.cbegin(),
+                               std::next(m_in_buf.buf.cbegin(), m_in_buf.size));
+        return m_front_end_buf;
+    }
+
+    const auto& buf = m_vad.remove_silence(m_in_buf.buf.data(), m_in_buf.size);
+
+    if (!buf.empty() && m_call_backs.front_end_output)
+        m_call_backs.front_end_output(buf.data(), buf.size());
+
+    return buf;
+}
+
+void stt_engine::set_low_latency(bool value) {
+    if (m_low_latency_requested != value) {
+        LOGD("low latency: " << !value << " => " << value);
+        m_low_latency_requested = value;
+    }
+}
+
+void stt_engine::set_decoding_profile(decoding_profile_t profile) {
+    // profile is read by engines when decoding starts, so it should be
+    // changed only when engine is stopped
+    if (m_config.decoding_profile != profile) {
+        LOGD("decoding profile: " << m_config.decoding_profile << " => "
+                                  << profile);
+        m_config.decoding_profile = profile;
+    }
+}
+
+void stt_engine::set_file_source(bool value) {
+    if (m_config.file_source != value) {
+        LOGD("file source: " << m_config.file_source << " => " << value);
+        m_config.file_source = value;
+    }
+}
+
+void stt_engine::set_low_power(bool value) {
+    if (m_config.low_power != value) {
+        LOGD("low power: " << m_config.low_power << " => " << value);
+        m_config.low_power = value;
+    }
+}
+
+void stt_engine::set_num_threads(unsigned int value) {
+    // threads are read by engines when decoding starts, so it should be
+    // changed only when engine is stopped
+    if (m_config.num_threads != value) {
+        LOGD("num threads: " << m_config.num_threads << " => " << value);
+        m_config.num_threads = value;
+    }
+}
+
+// Live dictation needs short response time, so fast profile uses greedy
+// sampling without temperature fallback and with a small text context.
+// File transcription also uses greedy sampling by default, beam search is
+// only used when accurate profile is selected explicitly. Thread count is
+// not raised by any profile, it is limited by num_threads from settings.
+stt_engine::decoding_params_t stt_engine::make_decoding_params(
+    decoding_profile_t profile) {
+    decoding_params_t params;
+
+    switch (profile) {
+        case decoding_profile_t::fast:
+            params.max_text_ctx = 64;
+            break;
+        case decoding_profile_t::balanced:
+            params.temperature_fallback = true;
+            break;
+        case decoding_profile_t::accurate:
+            params.beam_size = 5;
+            params.temperature_fallback = true;
+            params.use_context = true;
+            break;
+    }
+
+    return params;
+}
+
+void stt_engine::apply_low_latency() {
+    m_quantum_size = m_quantum_min_size;
+
+    if (m_config.low_latency) {
+        // window must fit into samples retained by vad between calls,
+        // otherwise a decision would not be made for every quantum
+        m_vad.set_window_msec(std::min(m_config.vad_window_msec > 0
+                                           ? m_config.vad_window_msec
+                                           : m_low_latency_vad_window_msec,
+                                       vad::max_continuous_window_msec()));
+    } else {
+        m_vad.set_window_msec(m_config.vad_window_msec);
+    }
+}
+
 void stt_engine::reset_in_processing() {
     LOGD("reset in processing");
 
@@ -360,6 +611,7 @@ void stt_engine::reset_in_processing() {
     m_start_time.reset();
     m_vad.reset();
     m_intermediate_text.reset();
+    if (m_punctuator) m_punctuator->reset_incremental();
     set_speech_detection_status(speech_detection_status_t::no_speech);
 
     reset_impl();
@@ -398,6 +650,10 @@ std::string stt_engine::merge_texts(const std::string& old_text,
 
 void stt_engine::set_intermediate_text(const std::string& text) {
     if (m_intermediate_text != text) {
+        if (!text.empty() && m_utterance_stats.speech_start &&
+            !m_utterance_stats.first_text)
+            m_utterance_stats.first_text = std::chrono::steady_clock::now();
+
         m_intermediate_text = text;
         if (m_intermediate_text->empty() ||
             m_intermediate_text->size() >= m_min_text_size) {
@@ -446,6 +702,8 @@ void stt_engine::set_processing_state(processing_state_t new_state) {
 void stt_engine::flush(flush_t type) {
     LOGD("flush: " << type);
 
+    log_utterance_stats();
+
     if (m_config.speech_mode == speech_mode_t::automatic) {
         set_speech_detection_status(speech_detection_status_t::no_speech);
     } else if (type != flush_t::restart &&
@@ -468,6 +726,8 @@ void stt_engine::flush(flush_t type) {
 
     m_intermediate_text.reset();
 
+    if (m_punctuator) m_punctuator->reset_incremental();
+
     if (type == flush_t::eof) {
         m_call_backs.eof();
     }
@@ -500,6 +760,10 @@ void stt_engine::set_speech_started(bool value) {
 void stt_engine::set_speech_detection_status(speech_detection_status_t status) {
     if (m_speech_detection_status == status) return;
 
+    if (status == speech_detection_status_t::speech_detected &&
+        !m_utterance_stats.speech_start)
+        m_utterance_stats.speech_start = std::chrono::steady_clock::now();
+
     auto old_speech_status = speech_detection_status();
 
     m_speech_detection_status = status;
@@ -539,6 +803,45 @@ bool stt_engine::sentence_timer_timed_out() {
     return false;
 }
 
+std::chrono::microseconds stt_engine::thread_cpu_time() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return std::chrono::seconds{ts.tv_sec} +
+           std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::nanoseconds{ts.tv_nsec});
+}
+
+// stats allow comparing latency and cpu usage of different processing
+// modes (e.g. vad vs native endpointing)
+void stt_engine::log_utterance_stats() {
+    const auto& stats = m_utterance_stats;
+
+    if (stats.samples > 0) {
+        auto to_ms = [](auto dur) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(dur)
+                .count();
+        };
+
+        auto audio_ms = stats.samples * 1000 / m_sample_rate;
+        auto cpu_ms = to_ms(stats.cpu_time);
+
+        LOGD("utterance stats: audio=" << audio_ms << "ms, cpu=" << cpu_ms
+                                       << "ms, cpu/audio="
+                                       << static_cast<double>(cpu_ms) /
+                                              std::max<size_t>(1, audio_ms)
+                                       << ", first-text-latency="
+                                       << (stats.speech_start &&
+                                                   stats.first_text
+                                               ? to_ms(*stats.first_text -
+                                                       *stats.speech_start)
+                                               : -1)
+                                       << "ms, native-endpointing="
+                                       << m_config.native_endpointing);
+    }
+
+    m_utterance_stats = {};
+}
+
 void stt_engine::restart_sentence_timer() {
     LOGT("staring sentence timer");
     m_start_time = std::chrono::steady_clock::now();
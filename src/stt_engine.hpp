@@ -21,6 +21,7 @@
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include "denoiser.hpp"
 #include "punctuator.hpp"
@@ -78,6 +79,8 @@ class stt_engine {
         std::function<void()> sentence_timeout;
         std::function<void()> eof;
         std::function<void()> error;
+        std::function<void(const int16_t* data, size_t size)>
+            front_end_output;
     };
 
     struct gpu_device_t {
@@ -97,6 +100,20 @@ class stt_engine {
     friend std::ostream& operator<<(std::ostream& os,
                                     const gpu_device_t& gpu_device);
 
+    enum class decoding_profile_t { fast = 0, balanced = 1, accurate = 2 };
+    friend std::ostream& operator<<(std::ostream& os,
+                                    decoding_profile_t profile);
+
+    struct decoding_params_t {
+        int beam_size = 1; /*1 means greedy sampling*/
+        bool temperature_fallback = false;
+        bool use_context = false; /*condition on previously decoded text*/
+        int max_text_ctx = 0;     /*0 means model default*/
+        int threads = 0;          /*upper limit, 0 means no limit*/
+    };
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const decoding_params_t& params);
+
     struct config_t {
         std::string lang;
         std::string lang_code;
@@ -106,6 +123,14 @@ class stt_engine {
         bool translate = false; /*extra whisper feature*/
         bool speech_started = false;
         bool use_gpu = false;
+        bool low_latency = false; /*small processing quantum for live audio*/
+        bool native_endpointing = false; /*only for streaming engines*/
+        bool external_front_end = false; /*input is denoised speech only*/
+        size_t vad_window_msec = 0; /*0 means default window*/
+        decoding_profile_t decoding_profile = decoding_profile_t::balanced;
+        bool file_source = false; /*audio from file, decoding can be deferred*/
+        bool low_power = false; /*no optional background work*/
+        unsigned int num_threads = 0; /*0 means engine default*/
         std::string options;
         gpu_device_t gpu_device;
         inline bool has_option(char c) const {
@@ -127,6 +152,16 @@ class stt_engine {
     inline auto speech_mode() const { return m_config.speech_mode; }
     void set_speech_started(bool value);
     inline auto speech_status() const { return m_config.speech_started; }
+    void set_low_latency(bool value);
+    void set_decoding_profile(decoding_profile_t profile);
+    inline auto decoding_profile() const { return m_config.decoding_profile; }
+    static decoding_params_t make_decoding_params(decoding_profile_t profile);
+    void set_file_source(bool value);
+    inline auto file_source() const { return m_config.file_source; }
+    void set_low_power(bool value);
+    inline auto low_power() const { return m_config.low_power; }
+    void set_num_threads(unsigned int value);
+    void push_front_end_samples(const int16_t* data, size_t size);
     inline const model_files_t& model_files() const {
         return m_config.model_files;
     }
@@ -134,6 +169,10 @@ class stt_engine {
     inline auto translate() const { return m_config.translate; }
     inline auto use_gpu() const { return m_config.use_gpu; }
     inline auto gpu_device() const { return m_config.gpu_device; }
+    inline auto vad_window_msec() const { return m_config.vad_window_msec; }
+    inline auto native_endpointing() const {
+        return m_config.native_endpointing;
+    }
 
    protected:
     enum class lock_type_t { free, processed, borrowed };
@@ -151,7 +190,15 @@ class stt_engine {
 
     inline static const size_t m_sample_rate = 16000;  // 1s
     inline static const size_t m_in_buf_max_size = 24000;
+    // processing quantum in low-latency mode
+    inline static const size_t m_quantum_min_size = m_sample_rate / 10;
+    inline static const size_t m_quantum_max_size = 3 * m_sample_rate / 10;
+    inline static const size_t m_quantum_idle_size = m_sample_rate / 2;
+    inline static const size_t m_low_latency_vad_window_msec = 300;
     inline static const size_t m_speech_max_size = m_sample_rate * 60;  // 60s
+    // preview engine falling behind drops the oldest samples
+    inline static const size_t m_front_end_queue_max_size =
+        m_sample_rate * 5;  // 5s
     inline static const unsigned int m_min_text_size = 4;
     inline static const auto m_timeout = 10s;
 
@@ -170,6 +217,13 @@ class stt_engine {
         }
     };
 
+    struct utterance_stats_t {
+        size_t samples = 0;
+        std::chrono::microseconds cpu_time{0};
+        std::optional<std::chrono::steady_clock::time_point> speech_start;
+        std::optional<std::chrono::steady_clock::time_point> first_text;
+    };
+
     config_t m_config;
     callbacks_t m_call_backs;
     std::thread m_processing_thread;
@@ -186,6 +240,13 @@ class stt_engine {
     std::optional<std::chrono::steady_clock::time_point> m_start_time;
     processing_state_t m_processing_state = processing_state_t::idle;
     std::optional<punctuator> m_punctuator;
+    std::atomic_bool m_low_latency_requested = false;
+    size_t m_quantum_size = m_quantum_min_size;
+    size_t m_quantum_locked_size = 0;
+    utterance_stats_t m_utterance_stats;
+    std::mutex m_front_end_mtx;
+    std::vector<int16_t> m_front_end_queue;
+    vad::buf_t m_front_end_buf;
 
     static void ltrim(std::string& s);
     static void rtrim(std::string& s);
@@ -198,6 +259,14 @@ class stt_engine {
     void flush(flush_t type);
     bool lock_buf(lock_type_t desired_lock);
     bool lock_buff_for_processing();
+    size_t processing_quantum() const;
+    void update_processing_quantum(std::chrono::microseconds processing_dur);
+    void apply_low_latency();
+    void log_utterance_stats();
+    void denoise_in_buf();
+    const vad::buf_t& remove_silence_from_in_buf();
+    void fill_in_buf_from_front_end();
+    static std::chrono::microseconds thread_cpu_time();
     void free_buf(lock_type_t lock);
     void free_buf();
     void set_speech_detection_status(speech_detection_status_t status);
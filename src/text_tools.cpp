@@ -151,20 +151,25 @@ static astrunc::access::lang_t lang_str_to_astrunc_lang(
     return astrunc::access::lang_t::NONE;
 }
 
-static std::vector<std::string> split_to_sentences(const std::string& text,
-                                                   split_engine_t engine,
-                                                   const std::string& lang,
-                                                   const std::string& nb_data) {
+nb_splitter_t make_nb_splitter(const std::string& nb_data) {
+    auto splitter = std::make_shared<ug::ssplit::SentenceSplitter>();
+
+    if (!nb_data.empty()) splitter->loadFromSerialized(nb_data);
+
+    return splitter;
+}
+
+static std::vector<std::string> split_to_sentences(
+    const std::string& text, split_engine_t engine, const std::string& lang,
+    const nb_splitter_t& nb_splitter) {
     std::vector<std::string> parts;
 
     switch (engine) {
         case split_engine_t::ssplit: {
-            ug::ssplit::SentenceSplitter ssplit{};
-
-            if (!nb_data.empty()) ssplit.loadFromSerialized(nb_data);
+            static const ug::ssplit::SentenceSplitter empty_splitter{};
 
             ug::ssplit::SentenceStream sentence_stream{
-                text, ssplit,
+                text, nb_splitter ? *nb_splitter : empty_splitter,
                 ug::ssplit::SentenceStream::splitmode::one_paragraph_per_line};
 
             std::string_view snt;
@@ -185,10 +190,10 @@ static std::vector<std::string> split_to_sentences(const std::string& text,
 
 std::pair<std::vector<std::string>, std::vector<break_line_info>> split(
     const std::string& text, split_engine_t engine, const std::string& lang,
-    const std::string& nb_data) {
+    const nb_splitter_t& nb_splitter) {
     std::pair<std::vector<std::string>, std::vector<break_line_info>> parts;
 
-    parts.first = split_to_sentences(text, engine, lang, nb_data);
+    parts.first = split_to_sentences(text, engine, lang, nb_splitter);
 
     size_t last_pos = 0;
 
@@ -572,6 +577,143 @@ static void convert_html_to_subrip(std::string& text) {
     text = std::regex_replace(text, std::regex{"</p>|</code>|</span>"}, "\n");
 }
 
+static bool is_subrip_timestamp(const std::string& line) {
+    return line.find("-->") != std::string::npos;
+}
+
+static bool is_subrip_id(const std::string& line) {
+    return !line.empty() &&
+           std::all_of(line.cbegin(), line.cend(), [](unsigned char c) {
+               return std::isdigit(c);
+           });
+}
+
+static bool has_subrip_markup(const std::string& text) {
+    static const std::regex tag_rx{"</?\\s*(i|b|u|font)\\b[^>]*>",
+                                   std::regex::icase};
+    return std::regex_search(text, tag_rx);
+}
+
+std::vector<subrip_segment_t> subrip_text_to_segments(const std::string& text) {
+    std::stringstream in_ss{text};
+    std::vector<subrip_segment_t> segments;
+
+    subrip_segment_t segment;
+    bool has_timestamp = false;
+    std::vector<std::string> head_lines;  // lines before timestamp
+
+    auto append_text = [&](std::string& line) {
+        if (!segment.text.empty()) segment.text.push_back(' ');
+        rtrim(line);
+        segment.text.append(line);
+        ++segment.line_count;
+    };
+
+    auto push_segment = [&] {
+        if (!has_timestamp && !head_lines.empty()) {
+            // cue without timestamp is kept as text, so nothing is lost
+            LOGW("subrip cue without timestamp: " << head_lines.front());
+            auto it = head_lines.begin();
+            if (head_lines.size() > 1 && is_subrip_id(*it))
+                segment.id.assign(*it++);
+            for (; it != head_lines.end(); ++it) append_text(*it);
+        }
+
+        if (has_timestamp || !head_lines.empty()) {
+            segment.markup = has_subrip_markup(segment.text);
+            segments.push_back(std::move(segment));
+        }
+
+        segment = {};
+        has_timestamp = false;
+        head_lines.clear();
+    };
+
+    for (std::string line; std::getline(in_ss, line);) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (segments.empty() && head_lines.empty() && !has_timestamp &&
+            line.size() >= 3 && line.compare(0, 3, "\xEF\xBB\xBF") == 0)
+            line.erase(0, 3);  // BOM
+
+        if (line.empty()) {
+            push_segment();
+            continue;
+        }
+
+        if (!has_timestamp) {
+            if (is_subrip_timestamp(line)) {
+                for (auto& id_line : head_lines) {
+                    if (!segment.id.empty()) segment.id.push_back('\n');
+                    segment.id.append(id_line);
+                }
+                head_lines.clear();
+                segment.timestamp.assign(line);
+                has_timestamp = true;
+            } else {
+                head_lines.push_back(std::move(line));
+            }
+            continue;
+        }
+
+        append_text(line);
+    }
+
+    push_segment();
+
+    return segments;
+}
+
+// breaks text into line_count lines of similar length
+static void break_subrip_text(std::string& text, size_t line_count) {
+    if (line_count < 2) return;
+
+    auto line_size = text.size() / line_count;
+
+    size_t pos = 0;
+    for (size_t i = 1; i < line_count; ++i) {
+        auto target = pos + line_size;
+        if (target >= text.size()) break;
+
+        auto right = text.find(' ', target);
+        auto left = text.rfind(' ', target);
+        if (left != std::string::npos && left <= pos) left = std::string::npos;
+
+        size_t brk = std::string::npos;
+        if (left == std::string::npos)
+            brk = right;
+        else if (right == std::string::npos)
+            brk = left;
+        else
+            brk = target - left <= right - target ? left : right;
+
+        if (brk == std::string::npos) break;
+
+        text[brk] = '\n';
+        pos = brk + 1;
+    }
+}
+
+std::string segments_to_subrip_text(
+    const std::vector<subrip_segment_t>& segments) {
+    std::string text;
+
+    for (const auto& segment : segments) {
+        if (!segment.id.empty()) text.append(segment.id).push_back('\n');
+        if (!segment.timestamp.empty())
+            text.append(segment.timestamp).push_back('\n');
+
+        if (!segment.text.empty()) {
+            auto segment_text = segment.text;
+            break_subrip_text(segment_text, segment.line_count);
+            text.append(segment_text).push_back('\n');
+        }
+
+        text.push_back('\n');
+    }
+
+    return text;
+}
+
 static void convert_markdown_to_html(std::string& text) {
     std::stringstream ss{text};
 
@@ -12,20 +12,36 @@
 #include <pybind11/pytypes.h>
 #define slots Q_SLOTS
 
+#include <memory>
 #include <optional>
 #include <piper-phonemize/tashkeel.hpp>
 #include <string>
 #include <vector>
 
+namespace ug::ssplit {
+class SentenceSplitter;
+}
+
 namespace text_tools {
 enum class split_engine_t { ssplit, astrunc };
 enum class text_format_t { markdown, subrip };
 
+// immutable sentence splitter with loaded non-breaking prefixes
+using nb_splitter_t = std::shared_ptr<const ug::ssplit::SentenceSplitter>;
+
 struct break_line_info {
     bool break_line = false;
     size_t count = 0;
 };
 
+struct subrip_segment_t {
+    std::string id;
+    std::string timestamp; /*empty when cue has no timestamp line*/
+    std::string text;
+    size_t line_count = 0;
+    bool markup = false; /*text has <i>, <b>, <u> or <font> tags*/
+};
+
 class processor {
    public:
     explicit processor(int device);
@@ -44,9 +60,10 @@ class processor {
     int m_device = -1;  // cuda device
 };
 
+nb_splitter_t make_nb_splitter(const std::string& nb_data);
 std::pair<std::vector<std::string>, std::vector<break_line_info>> split(
     const std::string& text, split_engine_t engine, const std::string& lang,
-    const std::string& nb_data = {});
+    const nb_splitter_t& nb_splitter = {});
 void restore_caps(std::string& text);
 void to_lower_case(std::string& text);
 void trim_lines(std::string& text);
@@ -61,6 +78,9 @@ void numbers_to_words(std::string& text, const std::string& lang,
 void convert_text_format_to_html(std::string& text, text_format_t input_format);
 void convert_text_format_from_html(std::string& text,
                                    text_format_t output_format);
+std::vector<subrip_segment_t> subrip_text_to_segments(const std::string& text);
+std::string segments_to_subrip_text(
+    const std::vector<subrip_segment_t>& segments);
 }  // namespace text_tools
 
 #endif  // TEXT_TOOLS_H
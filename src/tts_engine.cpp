@@ -8,7 +8,9 @@
 #include "tts_engine.hpp"
 
 #include <dirent.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -127,6 +129,7 @@ std::ostream& operator<<(std::ostream& os, const tts_engine::config_t& config) {
        << ", share-dir=" << config.share_dir
        << ", cache-dir=" << config.cache_dir << ", data-dir=" << config.data_dir
        << ", speech-speed=" << config.speech_speed
+       << ", num-threads=" << config.num_threads
        << ", use-gpu=" << config.use_gpu << ", gpu-device=["
        << config.gpu_device << "]"
        << ", audio-format=" << config.audio_format;
@@ -166,11 +169,15 @@ tts_engine::~tts_engine() {
 void tts_engine::start() {
     LOGD("tts start");
 
+    // processing thread is not joined until prerender synthesis is aborted
+    cancel_prerender();
+
     m_shutting_down = true;
     m_cv.notify_one();
     if (m_processing_thread.joinable()) m_processing_thread.join();
 
     m_queue = std::queue<task_t>{};
+    m_prerender_queue = std::queue<task_t>{};
     m_state = state_t::idle;
     m_shutting_down = false;
     m_processing_thread = std::thread{&tts_engine::process, this};
@@ -181,6 +188,8 @@ void tts_engine::start() {
 void tts_engine::stop() {
     LOGD("tts stop started");
 
+    cancel_prerender();
+
     m_shutting_down = true;
 
     set_state(state_t::idle);
@@ -235,7 +244,7 @@ std::string tts_engine::find_file_with_name_prefix(std::string dir_path,
     return {};
 }
 
-void tts_engine::encode_speech(std::string text) {
+void tts_engine::encode_speech(std::string text, bool offline) {
     if (m_shutting_down) return;
 
     auto tasks = make_tasks(text);
@@ -244,12 +253,72 @@ void tts_engine::encode_speech(std::string text) {
         std::lock_guard lock{m_mutex};
         for (auto& task : tasks) {
             LOGD("task: " << task.text);
+            task.offline = offline;
             m_queue.push(std::move(task));
         }
     }
 
     LOGD("task pushed");
 
+    cancel_prerender();
+
+    m_cv.notify_one();
+}
+
+void tts_engine::prerender_speech(const std::string& text) {
+    if (m_shutting_down) return;
+
+    auto tasks = make_tasks(text);
+
+    std::vector<std::string> parts;
+    parts.reserve(tasks.size());
+    for (const auto& task : tasks) parts.push_back(task.text);
+
+    std::queue<task_t> queue;
+    size_t changed_count = 0;
+
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        // first parts are played right after start, other parts are
+        // prerendered only when the user has just changed them
+        if (i >= m_prerender_max_parts) {
+            if (m_prerender_last_parts.empty() ||
+                changed_count >= m_prerender_max_parts ||
+                std::find(m_prerender_last_parts.cbegin(),
+                          m_prerender_last_parts.cend(),
+                          tasks[i].text) != m_prerender_last_parts.cend())
+                continue;
+            ++changed_count;
+        }
+
+        tasks[i].prerender = true;
+        queue.push(std::move(tasks[i]));
+    }
+
+    m_prerender_last_parts = std::move(parts);
+
+    LOGD("prerender tasks: " << queue.size());
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_prerender_queue = std::move(queue);
+        m_prerender_cancelled = false;
+    }
+
+    m_cv.notify_one();
+}
+
+void tts_engine::cancel_prerender() {
+    {
+        std::lock_guard lock{m_mutex};
+        m_prerender_queue = std::queue<task_t>{};
+        m_prerender_cancelled = true;
+    }
+
+    if (m_prerendering) {
+        LOGD("cancelling prerender");
+        cancel_prerender_impl();
+    }
+
     m_cv.notify_one();
 }
 
@@ -324,7 +393,8 @@ std::vector<tts_engine::task_t> tts_engine::make_tasks(const std::string& text,
         auto engine = m_config.has_option('a') ? text_tools::split_engine_t::astrunc
                                                : text_tools::split_engine_t::ssplit;
         auto [parts, _] =
-            text_tools::split(text, engine, m_config.lang, m_config.nb_data);
+            text_tools::split(text, engine, m_config.lang,
+                              m_config.nb_splitter);
         if (!parts.empty()) {
             tasks.reserve(parts.size());
 
@@ -483,15 +553,18 @@ void tts_engine::process() {
     LOGD("tts prosessing started");
 
     decltype(m_queue) queue;
+    decltype(m_prerender_queue) prerender_queue;
 
     while (!m_shutting_down && m_state != state_t::error) {
         {
             std::unique_lock<std::mutex> lock{m_mutex};
             m_cv.wait(lock, [this] {
                 return (m_shutting_down || m_state == state_t::error) ||
-                       !m_queue.empty();
+                       !m_queue.empty() || !m_prerender_queue.empty();
             });
             std::swap(queue, m_queue);
+            // prerendering only when there is nothing else to do
+            if (queue.empty()) std::swap(prerender_queue, m_prerender_queue);
         }
 
         if (m_shutting_down || m_state == state_t::error) break;
@@ -519,54 +592,25 @@ void tts_engine::process() {
 
         setup_ref_voice();
 
+        if (queue.empty()) {
+            encode_prerender_tasks(prerender_queue);
+            set_state(state_t::idle);
+            continue;
+        }
+
         set_state(state_t::encoding);
 
         while (!m_shutting_down && !queue.empty()) {
-            auto task = std::move(queue.front());
-            queue.pop();
-
-            auto output_file = path_to_output_file(task.text);
-
-            if (!file_exists(output_file)) {
-                auto new_text = m_text_processor.preprocess(
-                    /*text=*/task.text, /*options=*/m_config.options,
-                    /*lang=*/m_config.lang,
-                    /*lang_code=*/m_config.lang_code,
-                    /*prefix_path=*/m_config.share_dir,
-                    /*diacritizer_path=*/m_config.model_files.diacritizer_path);
-
-                auto output_file_wav =
-                    m_config.audio_format == audio_format_t::wav
-                        ? output_file
-                        : output_file + ".wav";
-
-                if (!encode_speech_impl(new_text, output_file_wav)) {
-                    unlink(output_file.c_str());
-                    LOGE("speech encoding error");
-                    if (m_call_backs.speech_encoded) {
-                        m_call_backs.speech_encoded(
-                            "", "", m_config.audio_format, task.last);
-                    }
-
-                    continue;
-                }
-
-                if (!model_supports_speed()) apply_speed(output_file_wav);
-
-                if (m_config.audio_format != audio_format_t::wav) {
-                    media_compressor{}.compress(
-                        {output_file_wav}, output_file,
-                        compressor_format_from_format(m_config.audio_format),
-                        media_compressor::quality_t::vbr_high);
-
-                    unlink(output_file_wav.c_str());
-                }
-            }
-
-            if (m_call_backs.speech_encoded) {
-                m_call_backs.speech_encoded(task.text, output_file,
-                                            m_config.audio_format, task.last);
-            }
+            // offline tasks are encoded in batches, because time to first
+            // audio doesn't matter for them
+            std::vector<task_t> tasks;
+            do {
+                tasks.push_back(std::move(queue.front()));
+                queue.pop();
+            } while (tasks.back().offline && tasks.size() < m_batch_max_size &&
+                     !queue.empty() && queue.front().offline);
+
+            encode_tasks(tasks);
         }
 
         set_state(state_t::idle);
@@ -577,6 +621,134 @@ void tts_engine::process() {
     LOGD("tts processing done");
 }
 
+static void set_idle_priority() {
+#ifdef __linux__
+    // on linux nice value is per thread
+    if (setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)),
+                    19) != 0)
+        LOGW("failed to set idle priority");
+#endif
+}
+
+void tts_engine::encode_prerender_tasks(std::queue<task_t>& tasks) {
+    if (!prerender_supported()) {
+        LOGD("prerendering not supported by engine");
+        tasks = {};
+        return;
+    }
+
+    m_prerendering = true;
+
+    while (!m_shutting_down && !m_prerender_cancelled && !tasks.empty()) {
+        {
+            // any foreground task cancels prerendering
+            std::lock_guard lock{m_mutex};
+            if (!m_queue.empty()) {
+                LOGD("prerendering cancelled");
+                break;
+            }
+        }
+
+        // encoding in short-lived low priority thread doesn't slow down
+        // the rest of the system and processing thread keeps its priority
+        std::thread{[this, task = std::move(tasks.front())]() {
+            set_idle_priority();
+            encode_tasks({task});
+        }}.join();
+
+        tasks.pop();
+    }
+
+    m_prerendering = false;
+
+    tasks = {};
+}
+
+bool tts_engine::encode_speech_batch_impl(
+    [[maybe_unused]] const std::vector<std::string>& texts,
+    [[maybe_unused]] const std::vector<std::string>& out_files) {
+    return false;
+}
+
+void tts_engine::encode_tasks(const std::vector<task_t>& tasks) {
+    std::vector<std::string> output_files;
+    output_files.reserve(tasks.size());
+    std::vector<std::string> output_files_wav;
+    output_files_wav.reserve(tasks.size());
+    std::vector<bool> encoded(tasks.size(), true);
+
+    // tasks with output in cache are skipped
+    std::vector<size_t> idxs;
+    std::vector<std::string> texts;
+    std::vector<std::string> out_files;
+
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        const auto& output_file =
+            output_files.emplace_back(path_to_output_file(tasks[i].text));
+        const auto& output_file_wav = output_files_wav.emplace_back(
+            m_config.audio_format == audio_format_t::wav
+                ? output_file
+                : output_file + ".wav");
+
+        if (file_exists(output_file)) continue;
+
+        idxs.push_back(i);
+        texts.push_back(m_text_processor.preprocess(
+            /*text=*/tasks[i].text, /*options=*/m_config.options,
+            /*lang=*/m_config.lang,
+            /*lang_code=*/m_config.lang_code,
+            /*prefix_path=*/m_config.share_dir,
+            /*diacritizer_path=*/m_config.model_files.diacritizer_path));
+        out_files.push_back(output_file_wav);
+    }
+
+    for (auto i : idxs) encoded[i] = false;
+
+    if (texts.size() > 1 && encode_speech_batch_impl(texts, out_files)) {
+        for (auto i : idxs) encoded[i] = true;
+    } else {
+        for (size_t i = 0; i < texts.size() && !m_shutting_down; ++i)
+            encoded[idxs[i]] = encode_speech_impl(texts[i], out_files[i]);
+    }
+
+    for (auto i : idxs) {
+        if (!encoded[i]) continue;
+
+        if (!model_supports_speed()) apply_speed(output_files_wav[i]);
+
+        if (m_config.audio_format != audio_format_t::wav) {
+            media_compressor{}.compress(
+                {output_files_wav[i]}, output_files[i],
+                compressor_format_from_format(m_config.audio_format),
+                media_compressor::quality_t::vbr_high);
+
+            unlink(output_files_wav[i].c_str());
+        }
+    }
+
+    for (size_t i = 0; i < tasks.size() && !m_shutting_down; ++i) {
+        if (tasks[i].prerender) {
+            if (!encoded[i]) unlink(output_files[i].c_str());
+            continue;
+        }
+
+        if (!encoded[i]) {
+            unlink(output_files[i].c_str());
+            LOGE("speech encoding error");
+            if (m_call_backs.speech_encoded) {
+                m_call_backs.speech_encoded("", "", m_config.audio_format,
+                                            tasks[i].last);
+            }
+            continue;
+        }
+
+        if (m_call_backs.speech_encoded) {
+            m_call_backs.speech_encoded(tasks[i].text, output_files[i],
+                                        m_config.audio_format, tasks[i].last);
+        }
+    }
+}
+
 void tts_engine::setup_ref_voice() {
     if (m_config.ref_voice_file.empty()) return;
 
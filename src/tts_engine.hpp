@@ -8,6 +8,7 @@
 #ifndef TTS_ENGINE_HPP
 #define TTS_ENGINE_HPP
 
+#include <atomic>
 #include <condition_variable>
 #include <fstream>
 #include <functional>
@@ -101,9 +102,10 @@ class tts_engine {
         std::string config_dir;
         std::string share_dir;
         std::string options;
-        std::string nb_data;
+        text_tools::nb_splitter_t nb_splitter;
         std::string lang_code;
         unsigned int speech_speed = 10;
+        unsigned int num_threads = 0; /*0 means engine default*/
         bool use_gpu = false;
         gpu_device_t gpu_device;
         audio_format_t audio_format = audio_format_t::wav;
@@ -126,7 +128,11 @@ class tts_engine {
     inline auto gpu_device() const { return m_config.gpu_device; }
     inline auto ref_voice_file() const { return m_config.ref_voice_file; }
     inline void restart() { m_restart_requested = true; }
-    void encode_speech(std::string text);
+    void encode_speech(std::string text, bool offline = false);
+    // encodes first parts of text and parts changed since the previous call
+    // into the cache in the background, results are not reported
+    void prerender_speech(const std::string& text);
+    void cancel_prerender();
     static std::string merge_wav_files(std::vector<std::string>&& files);
     void set_speech_speed(unsigned int speech_speed);
     void set_ref_voice_file(std::string ref_voice_file);
@@ -135,13 +141,23 @@ class tts_engine {
     struct task_t {
         std::string text;
         bool last = false;
+        bool offline = false; /*not played, can be encoded in batch*/
+        bool prerender = false; /*only stored in cache, not reported*/
     };
 
+    inline static const size_t m_batch_max_size = 8;
+    inline static const size_t m_prerender_max_parts = 3;
+
     config_t m_config;
     callbacks_t m_call_backs;
     std::thread m_processing_thread;
     bool m_shutting_down = false;
     std::queue<task_t> m_queue;
+    std::queue<task_t> m_prerender_queue;
+    std::vector<std::string> m_prerender_last_parts;
+    // encode_speech_impl is called in low priority thread
+    std::atomic_bool m_prerendering = false;
+    std::atomic_bool m_prerender_cancelled = false;
     std::mutex m_mutex;
     std::condition_variable m_cv;
     state_t m_state = state_t::idle;
@@ -166,9 +182,19 @@ class tts_engine {
     virtual void create_model() = 0;
     virtual bool encode_speech_impl(const std::string& text,
                                     const std::string& out_file) = 0;
+    virtual bool encode_speech_batch_impl(
+        const std::vector<std::string>& texts,
+        const std::vector<std::string>& out_files);
+    // prerendering is done only when synthesis runs in the thread that
+    // calls encode_speech_impl, because only that thread gets low priority
+    virtual bool prerender_supported() const { return true; }
+    // aborts synthesis of current prerender task, called from any thread
+    virtual void cancel_prerender_impl() {}
     void set_state(state_t new_state);
     std::string path_to_output_file(const std::string& text) const;
     void process();
+    void encode_tasks(const std::vector<task_t>& tasks);
+    void encode_prerender_tasks(std::queue<task_t>& tasks);
     std::vector<task_t> make_tasks(const std::string& text,
                                    bool split = true) const;
     void apply_speed(const std::string& file) const;
@@ -38,10 +38,27 @@ void vad::reset() {
     m_output_samples.clear();
     m_input_samples.clear();
     m_dup_size = 0;
+    m_speech_active = false;
 }
 
 vad::~vad() { WebRtcVad_Free(m_handle); }
 
+void vad::set_window_msec(size_t msec) {
+    auto chunks = msec == 0 ? m_default_chunks_in_frame
+                            : std::max<size_t>(1, msec / m_chunk_msec);
+
+    if (chunks == m_chunks_in_frame) return;
+
+    LOGD("vad window: " << m_chunks_in_frame * m_chunk_msec << " => "
+                        << chunks * m_chunk_msec);
+
+    m_chunks_in_frame = chunks;
+
+    reset();
+}
+
+size_t vad::window_msec() const { return m_chunks_in_frame * m_chunk_msec; }
+
 void vad::shift_left(std::vector<int16_t>& vec, size_t distance) {
     if (distance >= vec.size()) {
         vec.clear();
@@ -170,6 +187,8 @@ const vad::buf_t& vad::remove_silence(const buf_t::value_type* frame,
                         ? m_dup_max_size - m_input_samples.size()
                         : m_dup_max_size;
 
+    m_speech_active = cut_start.has_value();
+
     if (cut_start) {
         cut_stop.emplace(m_input_samples.size());
 
@@ -30,11 +30,21 @@ class vad {
     void restart();
     const buf_t& remove_silence(const buf_t::value_type* frame, size_t frame_size);
     bool is_speech(const buf_t::value_type* frame, size_t frame_size);
+    void set_window_msec(size_t msec);
+    size_t window_msec() const;
+    // true when speech continued until the end of last processed frame
+    inline bool speech_active() const { return m_speech_active; }
+    inline static size_t max_continuous_window_msec() {
+        return m_dup_max_size / m_chunk_size * m_chunk_msec;
+    }
 
    private:
     inline static const size_t m_chunk_size = 480;
+    inline static const size_t m_chunk_msec = 30;
     inline static const size_t m_dup_max_size = 10 * m_chunk_size;
-    inline static const size_t m_chunks_in_frame = 25;
+    inline static const size_t m_default_chunks_in_frame = 25;
+
+    size_t m_chunks_in_frame = m_default_chunks_in_frame;
 
     WebRtcVadInst* m_handle = nullptr;
     int m_mode = 3;
@@ -42,6 +52,7 @@ class vad {
     buf_t m_input_samples;
     buf_t m_output_samples;
     size_t m_dup_size = 0;
+    bool m_speech_active = false;
 
     std::vector<bool> vad_process(const buf_t& samples) const;
     static void shift_left(std::vector<int16_t>& vec, size_t distance);
@@ -122,6 +122,9 @@ void vosk_engine::open_vosk_lib() {
     m_vosk_api.vosk_recognizer_accept_waveform_s = reinterpret_cast<decltype(
         m_vosk_api.vosk_recognizer_accept_waveform_s)>(
         dlsym(m_vosklib_handle, "vosk_recognizer_accept_waveform_s"));
+    m_vosk_api.vosk_recognizer_result =
+        reinterpret_cast<decltype(m_vosk_api.vosk_recognizer_result)>(
+            dlsym(m_vosklib_handle, "vosk_recognizer_result"));
     m_vosk_api.vosk_recognizer_partial_result =
         reinterpret_cast<decltype(m_vosk_api.vosk_recognizer_partial_result)>(
             dlsym(m_vosklib_handle, "vosk_recognizer_partial_result"));
@@ -173,6 +176,7 @@ void vosk_engine::create_vosk_model() {
 
 void vosk_engine::reset_impl() {
     m_speech_buf.clear();
+    m_result_prev_segment.clear();
 
 #ifdef DUMP_AUDIO_TO_FILE
     m_file_audio_input.reset();
@@ -193,6 +197,8 @@ stt_engine::samples_process_result_t vosk_engine::process_buff() {
     if (!lock_buff_for_processing())
         return samples_process_result_t::wait_for_samples;
 
+    if (m_config.native_endpointing) return process_buff_native_endpointing();
+
     auto eof = m_in_buf.eof;
     auto sof = m_in_buf.sof;
 
@@ -218,7 +224,7 @@ stt_engine::samples_process_result_t vosk_engine::process_buff() {
         m_in_buf.size * sizeof(decltype(m_in_buf.buf)::value_type));
 #endif
 
-    m_denoiser.process(m_in_buf.buf.data(), m_in_buf.size);
+    denoise_in_buf();
 
 #ifdef DUMP_AUDIO_TO_FILE
     if (!m_file_audio_after_denoise)
@@ -229,8 +235,7 @@ stt_engine::samples_process_result_t vosk_engine::process_buff() {
         m_in_buf.size * sizeof(decltype(m_in_buf.buf)::value_type));
 #endif
 
-    const auto& vad_buf =
-        m_vad.remove_silence(m_in_buf.buf.data(), m_in_buf.size);
+    const auto& vad_buf = remove_silence_from_in_buf();
 
 #ifdef DUMP_AUDIO_TO_FILE
     if (!m_file_audio_after_vad)
@@ -311,6 +316,89 @@ stt_engine::samples_process_result_t vosk_engine::process_buff() {
     return samples_process_result_t::wait_for_samples;
 }
 
+// Audio is fed to the recognizer as it arrives and the end of utterance is
+// detected by vosk itself. VAD is used only to update speech detection
+// status.
+stt_engine::samples_process_result_t
+vosk_engine::process_buff_native_endpointing() {
+    auto eof = m_in_buf.eof;
+    auto sof = m_in_buf.sof;
+
+    LOGD("process samples buf (native endpointing): mode="
+         << m_config.speech_mode << ", in-buf size=" << m_in_buf.size
+         << ", sof=" << sof << ", eof=" << eof);
+
+    if (sof) {
+        m_start_time.reset();
+        m_vad.reset();
+        m_result_prev_segment.clear();
+
+        if (m_vosk_recognizer)
+            m_vosk_api.vosk_recognizer_reset(m_vosk_recognizer);
+    }
+
+    denoise_in_buf();
+
+    bool vad_status = m_vad.is_speech(m_in_buf.buf.data(), m_in_buf.size);
+
+    if (vad_status) {
+        LOGD("vad: speech detected");
+
+        if (m_config.speech_mode != speech_mode_t::manual &&
+            m_config.speech_mode != speech_mode_t::single_sentence)
+            set_speech_detection_status(
+                speech_detection_status_t::speech_detected);
+
+        restart_sentence_timer();
+    } else {
+        LOGD("vad: no speech");
+
+        if (m_config.speech_mode == speech_mode_t::single_sentence &&
+            (!m_intermediate_text || m_intermediate_text->empty()) &&
+            sentence_timer_timed_out()) {
+            LOGD("sentence timeout");
+            m_call_backs.sentence_timeout();
+        }
+    }
+
+    if (m_thread_exit_requested) {
+        m_in_buf.clear();
+        free_buf();
+        return samples_process_result_t::no_samples_needed;
+    }
+
+    set_processing_state(processing_state_t::decoding);
+
+    auto endpoint = decode_speech_native_endpointing(m_in_buf.buf.data(),
+                                                     m_in_buf.size, eof);
+
+    if (m_config.speech_started) set_processing_state(processing_state_t::idle);
+
+    m_in_buf.clear();
+
+    // endpoint on silence doesn't end single sentence, listening continues
+    // until something is decoded
+    auto has_text = m_intermediate_text && !m_intermediate_text->empty();
+    auto final_decode =
+        eof || (endpoint && m_config.speech_mode != speech_mode_t::manual &&
+                (has_text ||
+                 m_config.speech_mode != speech_mode_t::single_sentence));
+
+    if (final_decode)
+        flush(!eof && m_config.speech_mode == speech_mode_t::automatic
+                  ? flush_t::regular
+                  : flush_t::eof);
+
+    if (!vad_status && !final_decode &&
+        m_config.speech_mode == speech_mode_t::automatic &&
+        (!m_intermediate_text || m_intermediate_text->empty()))
+        set_speech_detection_status(speech_detection_status_t::no_speech);
+
+    free_buf();
+
+    return samples_process_result_t::wait_for_samples;
+}
+
 std::string vosk_engine::get_from_json(const char* name, const char* str) {
     auto json = simdjson::padded_string{str, strlen(str)};
 
@@ -369,10 +457,60 @@ void vosk_engine::decode_speech(const vosk_buf_t& buf, bool eof) {
     LOGD("speech decoded");
 #endif
 
-    if (m_punctuator) result = m_punctuator->process(result);
+    if (m_punctuator) result = m_punctuator->process_incremental(result);
 
     if (!m_intermediate_text || m_intermediate_text != result)
         set_intermediate_text(result);
 
     if (eof) m_vosk_api.vosk_recognizer_reset(m_vosk_recognizer);
 }
+
+bool vosk_engine::decode_speech_native_endpointing(const int16_t* data,
+                                                   size_t size, bool eof) {
+    auto ret = m_vosk_api.vosk_recognizer_accept_waveform_s(m_vosk_recognizer,
+                                                            data, size);
+
+    if (ret < 0) {
+        LOGE("error in vosk_recognizer_accept_waveform_s");
+        return false;
+    }
+
+    bool endpoint = ret == 1 || eof;
+
+    auto result = [&] {
+        if (eof)
+            return get_from_json(
+                "text",
+                m_vosk_api.vosk_recognizer_final_result(m_vosk_recognizer));
+        if (endpoint)
+            return get_from_json(
+                "text", m_vosk_api.vosk_recognizer_result(m_vosk_recognizer));
+
+        return get_from_json(
+            "partial",
+            m_vosk_api.vosk_recognizer_partial_result(m_vosk_recognizer));
+    }();
+
+    if (endpoint) LOGD("endpoint detected");
+
+    // in manual mode utterances are joined until speech is stopped
+    if (!m_result_prev_segment.empty()) {
+        result = result.empty() ? m_result_prev_segment
+                                : m_result_prev_segment + " " + result;
+    }
+
+    if (endpoint && !eof && m_config.speech_mode == speech_mode_t::manual)
+        m_result_prev_segment = result;
+    else if (endpoint)
+        m_result_prev_segment.clear();
+
+    if (!result.empty() && m_punctuator)
+        result = m_punctuator->process_incremental(result);
+
+    if (!m_intermediate_text || m_intermediate_text != result)
+        set_intermediate_text(result);
+
+    if (eof) m_vosk_api.vosk_recognizer_reset(m_vosk_recognizer);
+
+    return endpoint;
+}
@@ -42,6 +42,8 @@ class vosk_engine : public stt_engine {
         int (*vosk_recognizer_accept_waveform_s)(VoskRecognizer* recognizer,
                                                  const short* data,
                                                  int length) = nullptr;
+        const char* (*vosk_recognizer_result)(VoskRecognizer* recognizer) =
+            nullptr;
         const char* (*vosk_recognizer_partial_result)(
             VoskRecognizer* recognizer) = nullptr;
         const char* (*vosk_recognizer_final_result)(
@@ -51,7 +53,7 @@ class vosk_engine : public stt_engine {
             return vosk_model_new && vosk_model_free && vosk_recognizer_new &&
                    vosk_recognizer_reset && vosk_recognizer_free &&
                    vosk_recognizer_accept_waveform_s &&
-                   vosk_recognizer_partial_result &&
+                   vosk_recognizer_result && vosk_recognizer_partial_result &&
                    vosk_recognizer_final_result;
         }
     };
@@ -59,6 +61,7 @@ class vosk_engine : public stt_engine {
     inline static const size_t m_speech_max_size = m_sample_rate * 60;  // 60s
 
     vosk_buf_t m_speech_buf;
+    std::string m_result_prev_segment;
     vosk_api m_vosk_api;
     void* m_vosklib_handle = nullptr;
     VoskModel* m_vosk_model = nullptr;
@@ -74,7 +77,10 @@ class vosk_engine : public stt_engine {
     void open_vosk_lib();
     void create_vosk_model();
     samples_process_result_t process_buff() override;
+    samples_process_result_t process_buff_native_endpointing();
     void decode_speech(const vosk_buf_t& buf, bool eof);
+    bool decode_speech_native_endpointing(const int16_t* data, size_t size,
+                                          bool eof);
     void reset_impl() override;
     void start_processing_impl() override;
     void push_inbuf_to_samples();
@@ -20,7 +20,6 @@
 whisper_engine::whisper_engine(config_t config, callbacks_t call_backs)
     : stt_engine{std::move(config), std::move(call_backs)} {
     open_whisper_lib();
-    m_wparams = make_wparams();
     m_speech_buf.reserve(m_speech_max_size);
 }
 
@@ -29,6 +28,8 @@ whisper_engine::~whisper_engine() {
 
     stop();
 
+    free_speculative_state();
+
     if (m_whisper_api.ok()) {
         if (m_whisper_ctx) {
             m_whisper_api.whisper_free(m_whisper_ctx);
@@ -187,6 +188,26 @@ void whisper_engine::open_whisper_lib() {
         LOGE("failed to register whisper api");
         throw std::runtime_error("failed to register whisper api");
     }
+
+    // optional api used for speculative decoding
+    m_whisper_api.whisper_init_state =
+        reinterpret_cast<decltype(m_whisper_api.whisper_init_state)>(
+            dlsym(m_whisperlib_handle, "whisper_init_state"));
+    m_whisper_api.whisper_free_state =
+        reinterpret_cast<decltype(m_whisper_api.whisper_free_state)>(
+            dlsym(m_whisperlib_handle, "whisper_free_state"));
+    m_whisper_api.whisper_full_with_state =
+        reinterpret_cast<decltype(m_whisper_api.whisper_full_with_state)>(
+            dlsym(m_whisperlib_handle, "whisper_full_with_state"));
+    m_whisper_api.whisper_full_n_segments_from_state = reinterpret_cast<
+        decltype(m_whisper_api.whisper_full_n_segments_from_state)>(
+        dlsym(m_whisperlib_handle, "whisper_full_n_segments_from_state"));
+    m_whisper_api.whisper_full_get_segment_text_from_state = reinterpret_cast<
+        decltype(m_whisper_api.whisper_full_get_segment_text_from_state)>(
+        dlsym(m_whisperlib_handle, "whisper_full_get_segment_text_from_state"));
+
+    if (!m_whisper_api.state_ok())
+        LOGW("whisper state api is missing, speculative decoding disabled");
 }
 
 void whisper_engine::push_buf_to_whisper_buf(
@@ -200,7 +221,11 @@ void whisper_engine::push_buf_to_whisper_buf(
                    });
 }
 
-void whisper_engine::reset_impl() { m_speech_buf.clear(); }
+void whisper_engine::reset_impl() {
+    // state is created again on first pause after restart
+    free_speculative_state();
+    m_speech_buf.clear();
+}
 
 void whisper_engine::stop_processing_impl() {
     if (m_whisper_ctx) {
@@ -208,7 +233,11 @@ void whisper_engine::stop_processing_impl() {
     }
 }
 
-void whisper_engine::start_processing_impl() { create_whisper_model(); }
+void whisper_engine::start_processing_impl() {
+    // decoding profile might have been changed while engine was stopped
+    m_wparams = make_wparams();
+    create_whisper_model();
+}
 
 void whisper_engine::create_whisper_model() {
     if (m_whisper_ctx) return;
@@ -244,10 +273,9 @@ stt_engine::samples_process_result_t whisper_engine::process_buff() {
         m_vad.reset();
     }
 
-    m_denoiser.process(m_in_buf.buf.data(), m_in_buf.size);
+    denoise_in_buf();
 
-    const auto& vad_buf =
-        m_vad.remove_silence(m_in_buf.buf.data(), m_in_buf.size);
+    const auto& vad_buf = remove_silence_from_in_buf();
 
     m_in_buf.clear();
 
@@ -261,6 +289,11 @@ stt_engine::samples_process_result_t whisper_engine::process_buff() {
             set_speech_detection_status(
                 speech_detection_status_t::speech_detected);
 
+        if (m_speculative) {
+            LOGD("speech resumed, discarding speculative decode");
+            cancel_speculative_decode();
+        }
+
         push_buf_to_whisper_buf(vad_buf, m_speech_buf);
 
         restart_sentence_timer();
@@ -309,6 +342,14 @@ stt_engine::samples_process_result_t whisper_engine::process_buff() {
             return samples_process_result_t::no_samples_needed;
         }
 
+        // pause has just started, so decoding is started before
+        // vad confirms the end of speech
+        if (vad_status && !m_vad.speech_active() &&
+            !m_config.low_power &&
+            (m_config.speech_mode == speech_mode_t::automatic ||
+             m_config.speech_mode == speech_mode_t::single_sentence))
+            start_speculative_decode();
+
         free_buf();
         return samples_process_result_t::wait_for_samples;
     }
@@ -326,7 +367,12 @@ stt_engine::samples_process_result_t whisper_engine::process_buff() {
 
     LOGD("speech frame: samples=" << m_speech_buf.size());
 
-    decode_speech(m_speech_buf);
+    if (auto text = finish_speculative_decode()) {
+        LOGD("using speculative decode result");
+        set_decoded_text(*text);
+    } else {
+        decode_speech(m_speech_buf);
+    }
 
     set_processing_state(processing_state_t::idle);
 
@@ -359,9 +405,22 @@ static bool abort_callback(void* user_data) {
     return is_aborted;
 }
 
+static bool speculative_encoder_begin_callback(
+    [[maybe_unused]] whisper_context* ctx,
+    [[maybe_unused]] whisper_state* state, void* user_data) {
+    return !static_cast<std::atomic_bool*>(user_data)->load();
+}
+
+static bool speculative_abort_callback(void* user_data) {
+    return static_cast<std::atomic_bool*>(user_data)->load();
+}
+
 whisper_full_params whisper_engine::make_wparams() {
-    whisper_full_params wparams =
-        m_whisper_api.whisper_full_default_params(WHISPER_SAMPLING_GREEDY);
+    auto params = make_decoding_params(m_config.decoding_profile);
+
+    whisper_full_params wparams = m_whisper_api.whisper_full_default_params(
+        params.beam_size > 1 ? WHISPER_SAMPLING_BEAM_SEARCH
+                             : WHISPER_SAMPLING_GREEDY);
 
     if (auto pos = m_config.lang.find('-'); pos != std::string::npos) {
         m_config.lang = m_config.lang.substr(0, pos);
@@ -374,15 +433,26 @@ whisper_full_params whisper_engine::make_wparams() {
     wparams.suppress_non_speech_tokens = true;
     wparams.single_segment = false;
     wparams.translate = m_config.translate;
-    wparams.no_context = true;
+    wparams.no_context = !params.use_context;
+    if (params.beam_size > 1) wparams.beam_search.beam_size = params.beam_size;
+    if (!params.temperature_fallback) wparams.temperature_inc = 0.0f;
+    if (params.max_text_ctx > 0) wparams.n_max_text_ctx = params.max_text_ctx;
+    // configured number of threads replaces the default, decoding profile
+    // can only lower it
+    auto threads = m_config.num_threads > 0
+                       ? static_cast<int>(m_config.num_threads)
+                       : m_threads;
+    if (params.threads > 0) threads = std::min(threads, params.threads);
     wparams.n_threads = std::min(
-        m_threads,
+        threads,
         std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
     wparams.encoder_begin_callback = encoder_begin_callback;
     wparams.encoder_begin_callback_user_data = &m_thread_exit_requested;
     wparams.abort_callback = abort_callback;
     wparams.abort_callback_user_data = &m_thread_exit_requested;
 
+    LOGD("decoding profile: " << m_config.decoding_profile << " ["
+                              << params << "]");
     LOGD("cpu info: arch=" << cpu_tools::arch() << ", cores="
                            << std::thread::hardware_concurrency());
     LOGD("using threads: " << wparams.n_threads << "/"
@@ -392,40 +462,42 @@ whisper_full_params whisper_engine::make_wparams() {
     return wparams;
 }
 
-void whisper_engine::decode_speech(const whisper_buf_t& buf) {
-    LOGD("speech decoding started");
+std::optional<std::string> whisper_engine::decode(
+    const whisper_buf_t& buf, whisper_state* state,
+    const whisper_full_params& params) {
+    auto decoding_start = std::chrono::steady_clock::now();
 
-    create_whisper_model();
+    auto ret = state ? m_whisper_api.whisper_full_with_state(
+                           m_whisper_ctx, state, params, buf.data(), buf.size())
+                     : m_whisper_api.whisper_full(m_whisper_ctx, params,
+                                                  buf.data(), buf.size());
+    if (ret != 0) {
+        LOGE("whisper error: " << ret);
+        return std::nullopt;
+    }
 
-    auto decoding_start = std::chrono::steady_clock::now();
+    auto n = state ? m_whisper_api.whisper_full_n_segments_from_state(state)
+                   : m_whisper_api.whisper_full_n_segments(m_whisper_ctx);
+    LOGD("decoded segments: " << n);
 
     std::ostringstream os;
 
-    if (auto ret = m_whisper_api.whisper_full(m_whisper_ctx, m_wparams,
-                                              buf.data(), buf.size());
-        ret == 0) {
-        auto n = m_whisper_api.whisper_full_n_segments(m_whisper_ctx);
-        LOGD("decoded segments: " << n);
-
-        for (auto i = 0; i < n; ++i) {
-            std::string text =
-                m_whisper_api.whisper_full_get_segment_text(m_whisper_ctx, i);
-            rtrim(text);
-            ltrim(text);
+    for (auto i = 0; i < n; ++i) {
+        std::string text =
+            state ? m_whisper_api.whisper_full_get_segment_text_from_state(
+                        state, i)
+                  : m_whisper_api.whisper_full_get_segment_text(m_whisper_ctx,
+                                                                i);
+        rtrim(text);
+        ltrim(text);
 #ifdef DEBUG
-            LOGD("segment " << i << ": " << text);
+        LOGD("segment " << i << ": " << text);
 #endif
-            if (i != 0) os << ' ';
+        if (i != 0) os << ' ';
 
-            os << text;
-        }
-    } else {
-        LOGE("whisper error: " << ret);
-        return;
+        os << text;
     }
 
-    if (m_thread_exit_requested) return;
-
     auto decoding_dur = std::chrono::duration_cast<std::chrono::milliseconds>(
                             std::chrono::steady_clock::now() - decoding_start)
                             .count();
@@ -436,8 +508,12 @@ void whisper_engine::decode_speech(const whisper_buf_t& buf) {
                 ((1000 * buf.size()) / static_cast<double>(m_sample_rate))
          << ")");
 
-    auto result =
-        merge_texts(m_intermediate_text.value_or(std::string{}), os.str());
+    return os.str();
+}
+
+void whisper_engine::set_decoded_text(const std::string& text) {
+    auto result = merge_texts(m_intermediate_text.value_or(std::string{}),
+                              std::string{text});
 
 #ifdef DEBUG
     LOGD("speech decoded: text=" << result);
@@ -446,3 +522,85 @@ void whisper_engine::decode_speech(const whisper_buf_t& buf) {
     if (!m_intermediate_text || m_intermediate_text != result)
         set_intermediate_text(result);
 }
+
+void whisper_engine::decode_speech(const whisper_buf_t& buf) {
+    LOGD("speech decoding started");
+
+    create_whisper_model();
+
+    auto text = decode(buf, nullptr, m_wparams);
+
+    if (!text || m_thread_exit_requested) return;
+
+    set_decoded_text(*text);
+}
+
+void whisper_engine::start_speculative_decode() {
+    cancel_speculative_decode();
+
+    if (!m_whisper_api.state_ok() || m_speech_buf.empty()) return;
+
+    create_whisper_model();
+
+    if (!m_speculative_state) {
+        m_speculative_state = m_whisper_api.whisper_init_state(m_whisper_ctx);
+        if (!m_speculative_state) {
+            LOGE("failed to create whisper state");
+            return;
+        }
+    }
+
+    LOGD("speculative decoding started: samples=" << m_speech_buf.size());
+
+    m_speculative = std::make_unique<speculative_decode_t>();
+    m_speculative->samples = m_speech_buf.size();
+
+    // speculative decoding is also aborted on exit, because reset_impl()
+    // is called when processing thread ends
+    auto params = m_wparams;
+    params.encoder_begin_callback = speculative_encoder_begin_callback;
+    params.encoder_begin_callback_user_data = &m_speculative->aborted;
+    params.abort_callback = speculative_abort_callback;
+    params.abort_callback_user_data = &m_speculative->aborted;
+
+    m_speculative->thread = std::thread{
+        [this, params, spec = m_speculative.get(), buf = m_speech_buf] {
+            auto text = decode(buf, m_speculative_state, params);
+            if (!spec->aborted) spec->text = std::move(text);
+        }};
+}
+
+void whisper_engine::cancel_speculative_decode() {
+    if (!m_speculative) return;
+
+    m_speculative->aborted = true;
+    if (m_speculative->thread.joinable()) m_speculative->thread.join();
+    m_speculative.reset();
+}
+
+void whisper_engine::free_speculative_state() {
+    cancel_speculative_decode();
+
+    if (m_speculative_state && m_whisper_api.state_ok()) {
+        m_whisper_api.whisper_free_state(m_speculative_state);
+        LOGD("speculative whisper state freed");
+    }
+
+    m_speculative_state = nullptr;
+}
+
+std::optional<std::string> whisper_engine::finish_speculative_decode() {
+    if (!m_speculative) return std::nullopt;
+
+    if (m_speculative->samples != m_speech_buf.size()) {
+        cancel_speculative_decode();
+        return std::nullopt;
+    }
+
+    if (m_speculative->thread.joinable()) m_speculative->thread.join();
+
+    auto text = std::move(m_speculative->text);
+    m_speculative.reset();
+
+    return text;
+}
@@ -10,8 +10,11 @@
 
 #include <whisper.h>
 
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "stt_engine.hpp"
@@ -43,12 +46,36 @@ class whisper_engine : public stt_engine {
         void (*whisper_free)(whisper_context* ctx) = nullptr;
         whisper_full_params (*whisper_full_default_params)(
             whisper_sampling_strategy strategy) = nullptr;
+        whisper_state* (*whisper_init_state)(whisper_context* ctx) = nullptr;
+        void (*whisper_free_state)(whisper_state* state) = nullptr;
+        int (*whisper_full_with_state)(whisper_context* ctx,
+                                       whisper_state* state,
+                                       whisper_full_params params,
+                                       const float* samples,
+                                       int n_samples) = nullptr;
+        int (*whisper_full_n_segments_from_state)(whisper_state* state) =
+            nullptr;
+        const char* (*whisper_full_get_segment_text_from_state)(
+            whisper_state* state, int i_segment) = nullptr;
         inline auto ok() const {
             return whisper_init_from_file && whisper_print_system_info &&
                    whisper_full && whisper_full_n_segments &&
                    whisper_full_get_segment_text && whisper_free &&
                    whisper_full_default_params;
         }
+        inline auto state_ok() const {
+            return whisper_init_state && whisper_free_state &&
+                   whisper_full_with_state &&
+                   whisper_full_n_segments_from_state &&
+                   whisper_full_get_segment_text_from_state;
+        }
+    };
+
+    struct speculative_decode_t {
+        std::thread thread;
+        std::atomic_bool aborted = false;
+        size_t samples = 0;
+        std::optional<std::string> text;
     };
 
     whisper_buf_t m_speech_buf;
@@ -56,11 +83,21 @@ class whisper_engine : public stt_engine {
     void* m_whisperlib_handle = nullptr;
     whisper_context* m_whisper_ctx = nullptr;
     whisper_full_params m_wparams{};
+    whisper_state* m_speculative_state = nullptr;
+    std::unique_ptr<speculative_decode_t> m_speculative;
 
     void open_whisper_lib();
     void create_whisper_model();
     samples_process_result_t process_buff() override;
     void decode_speech(const whisper_buf_t& buf);
+    std::optional<std::string> decode(const whisper_buf_t& buf,
+                                      whisper_state* state,
+                                      const whisper_full_params& params);
+    void set_decoded_text(const std::string& text);
+    void start_speculative_decode();
+    void cancel_speculative_decode();
+    void free_speculative_state();
+    std::optional<std::string> finish_speculative_decode();
     static void push_buf_to_whisper_buf(
         const std::vector<in_buf_t::buf_t::value_type>& buf,
         whisper_buf_t& whisper_buf);
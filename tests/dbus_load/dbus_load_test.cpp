@@ -0,0 +1,383 @@
+/* Copyright (C) 2023 Michal Kosciesza <michal@mkiol.net>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// Load and soak test of speech service DBus API. Many simulated clients,
+// each with its own bus connection, issue mixed calls against running
+// service. Use run_dbus_load_test.sh to run it on a private session bus.
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDBusConnection>
+#include <QDBusConnectionInterface>
+#include <QDBusPendingCallWatcher>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QTimer>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "config.h"
+#include "dbus_speech_inf.h"
+
+struct options_t {
+    QString service = QStringLiteral(APP_DBUS_SPEECH_SERVICE);
+    int clients = 8;
+    int duration = 60;
+    int think_time = 200;
+    int report_interval = 10;
+    QString audio_file;
+    QString text =
+        QStringLiteral("The quick brown fox jumps over the lazy dog.");
+    QString stt_lang;
+    QString tts_lang;
+    QString mnt_lang;
+    QString mnt_out_lang;
+};
+
+struct stats_t {
+    std::map<QString, size_t> calls;
+    std::map<QString, size_t> errors;
+    std::vector<double> call_latencies;
+    std::vector<double> task_latencies;
+    size_t tasks_started = 0;
+    size_t tasks_finished = 0;
+};
+
+using clock_type = std::chrono::steady_clock;
+
+static double ms_since(clock_type::time_point start) {
+    return std::chrono::duration<double, std::milli>(clock_type::now() - start)
+        .count();
+}
+
+static double percentile(std::vector<double> values, double p) {
+    if (values.empty()) return 0.0;
+    std::sort(values.begin(), values.end());
+    return values[static_cast<size_t>(p * (values.size() - 1))];
+}
+
+static long service_rss_kb(const QString &service) {
+    auto pid =
+        QDBusConnection::sessionBus().interface()->servicePid(service).value();
+    if (pid == 0) return 0;
+
+    QFile status{QStringLiteral("/proc/%1/status").arg(pid)};
+    if (!status.open(QIODevice::ReadOnly)) return 0;
+
+    while (!status.atEnd()) {
+        auto line = QString::fromLatin1(status.readLine());
+        if (line.startsWith(QLatin1String("VmRSS:")))
+            return line.mid(6).trimmed().split(' ').first().toLong();
+    }
+
+    return 0;
+}
+
+class client {
+   public:
+    client(int id, const options_t &options, stats_t &stats)
+        : m_options{options},
+          m_stats{stats},
+          m_con{QDBusConnection::connectToBus(
+              QDBusConnection::SessionBus,
+              QStringLiteral("dbus_load_test_%1").arg(id))},
+          m_iface{options.service, QStringLiteral("/"), m_con},
+          m_rng{static_cast<std::mt19937::result_type>(id)} {
+        m_timer.setSingleShot(true);
+        QObject::connect(&m_timer, &QTimer::timeout, [this] { next_call(); });
+
+        QObject::connect(&m_iface,
+                         &OrgMkiolSpeechInterface::SttFileTranscribeFinished,
+                         [this](int task) { handle_task_finished(task); });
+        QObject::connect(
+            &m_iface, &OrgMkiolSpeechInterface::TtsSpeechToFileFinished,
+            [this](const QString &, int task) { handle_task_finished(task); });
+        QObject::connect(
+            &m_iface, &OrgMkiolSpeechInterface::MntTranslateFinished,
+            [this](const QString &, const QString &, const QString &,
+                   const QString &, int task) { handle_task_finished(task); });
+    }
+
+    void start() { schedule_next_call(); }
+
+    void stop() {
+        m_stopped = true;
+        m_timer.stop();
+    }
+
+   private:
+    enum class call_t {
+        transcribe,
+        speech_to_file,
+        translate,
+        cancel,
+        keep_alive
+    };
+
+    const options_t &m_options;
+    stats_t &m_stats;
+    QDBusConnection m_con;
+    OrgMkiolSpeechInterface m_iface;
+    QTimer m_timer;
+    std::mt19937 m_rng;
+    std::unordered_map<int, clock_type::time_point> m_tasks;
+    int m_last_task = -1;
+    bool m_stopped = false;
+
+    void schedule_next_call() {
+        if (m_stopped) return;
+        std::uniform_int_distribution<int> dist{0, m_options.think_time};
+        m_timer.start(dist(m_rng));
+    }
+
+    call_t random_call() {
+        // task-starting calls are the most common ones
+        std::discrete_distribution<int> dist{
+            m_options.audio_file.isEmpty() ? 0.0 : 3.0, 3.0, 3.0, 1.0, 2.0};
+        return static_cast<call_t>(dist(m_rng));
+    }
+
+    void next_call() {
+        auto start = clock_type::now();
+
+        switch (random_call()) {
+            case call_t::transcribe:
+                watch(QStringLiteral("SttTranscribeFile"),
+                      m_iface.SttTranscribeFile(m_options.audio_file,
+                                                m_options.stt_lang, {}),
+                      start, true);
+                break;
+            case call_t::speech_to_file:
+                watch(QStringLiteral("TtsSpeechToFile"),
+                      m_iface.TtsSpeechToFile(m_options.text,
+                                              m_options.tts_lang, {}),
+                      start, true);
+                break;
+            case call_t::translate:
+                watch(QStringLiteral("MntTranslate"),
+                      m_iface.MntTranslate(m_options.text, m_options.mnt_lang,
+                                           m_options.mnt_out_lang),
+                      start, true);
+                break;
+            case call_t::cancel:
+                watch(QStringLiteral("Cancel"), m_iface.Cancel(m_last_task),
+                      start, false);
+                break;
+            case call_t::keep_alive:
+                watch(QStringLiteral("KeepAliveTask"),
+                      m_iface.KeepAliveTask(m_last_task), start, false);
+                break;
+        }
+    }
+
+    void watch(const QString &method, const QDBusPendingCall &call,
+               clock_type::time_point start, bool starts_task) {
+        auto *watcher = new QDBusPendingCallWatcher{call};
+
+        QObject::connect(
+            watcher, &QDBusPendingCallWatcher::finished,
+            [this, method, start, starts_task](QDBusPendingCallWatcher *w) {
+                QDBusPendingReply<int> reply = *w;
+                w->deleteLater();
+
+                m_stats.call_latencies.push_back(ms_since(start));
+                ++m_stats.calls[method];
+
+                // cancel and keep-alive of preempted task may fail, only
+                // bus errors are counted for them
+                if (reply.isError() || (starts_task && reply.value() < 0)) {
+                    ++m_stats.errors[method];
+                } else if (starts_task) {
+                    m_last_task = reply.value();
+                    m_tasks.emplace(m_last_task, start);
+                    ++m_stats.tasks_started;
+                }
+
+                schedule_next_call();
+            });
+    }
+
+    void handle_task_finished(int task) {
+        auto it = m_tasks.find(task);
+        if (it == m_tasks.end()) return;
+
+        m_stats.task_latencies.push_back(ms_since(it->second));
+        ++m_stats.tasks_finished;
+        m_tasks.erase(it);
+    }
+};
+
+static void print_report(const stats_t &stats, double elapsed_s,
+                         long rss_start, long rss_now) {
+    size_t calls = 0;
+    size_t errors = 0;
+    for (const auto &[method, count] : stats.calls) calls += count;
+    for (const auto &[method, count] : stats.errors) errors += count;
+
+    std::printf("[%.0fs] calls=%zu (%.1f/s), errors=%zu (%.2f%%)\n",
+                elapsed_s, calls, calls / elapsed_s, errors,
+                calls == 0 ? 0.0 : 100.0 * errors / calls);
+    for (const auto &[method, count] : stats.calls) {
+        auto it = stats.errors.find(method);
+        std::printf("  %s: calls=%zu, errors=%zu\n", qPrintable(method), count,
+                    it == stats.errors.end() ? 0 : it->second);
+    }
+    std::printf("  call latency ms: p50=%.1f, p90=%.1f, p99=%.1f\n",
+                percentile(stats.call_latencies, 0.5),
+                percentile(stats.call_latencies, 0.9),
+                percentile(stats.call_latencies, 0.99));
+    std::printf(
+        "  tasks: started=%zu, finished=%zu (%.2f/s), latency ms: p50=%.1f, "
+        "p90=%.1f, p99=%.1f\n",
+        stats.tasks_started, stats.tasks_finished,
+        stats.tasks_finished / elapsed_s, percentile(stats.task_latencies, 0.5),
+        percentile(stats.task_latencies, 0.9),
+        percentile(stats.task_latencies, 0.99));
+    std::printf("  service rss: %ld kB (growth %+ld kB)\n", rss_now,
+                rss_now - rss_start);
+    std::fflush(stdout);
+}
+
+static options_t parse_options(const QCoreApplication &app) {
+    QCommandLineParser parser;
+    parser.addHelpOption();
+
+    QCommandLineOption service_opt{QStringLiteral("service"),
+                                   QStringLiteral("DBus service name."),
+                                   QStringLiteral("name")};
+    QCommandLineOption clients_opt{QStringLiteral("clients"),
+                                   QStringLiteral("Number of clients."),
+                                   QStringLiteral("number")};
+    QCommandLineOption duration_opt{QStringLiteral("duration"),
+                                    QStringLiteral("Test duration."),
+                                    QStringLiteral("seconds")};
+    QCommandLineOption think_opt{
+        QStringLiteral("think-time"),
+        QStringLiteral("Max delay between calls of one client."),
+        QStringLiteral("ms")};
+    QCommandLineOption report_opt{QStringLiteral("report-interval"),
+                                  QStringLiteral("Report interval."),
+                                  QStringLiteral("seconds")};
+    QCommandLineOption audio_opt{
+        QStringLiteral("audio-file"),
+        QStringLiteral("Audio file to transcribe. When not set, "
+                       "SttTranscribeFile is not called."),
+        QStringLiteral("file")};
+    QCommandLineOption text_opt{
+        QStringLiteral("text"),
+        QStringLiteral("Text to synthesize and translate."),
+        QStringLiteral("text")};
+    QCommandLineOption stt_lang_opt{QStringLiteral("stt-lang"),
+                                    QStringLiteral("STT language or model id."),
+                                    QStringLiteral("id")};
+    QCommandLineOption tts_lang_opt{QStringLiteral("tts-lang"),
+                                    QStringLiteral("TTS language or model id."),
+                                    QStringLiteral("id")};
+    QCommandLineOption mnt_lang_opt{
+        QStringLiteral("mnt-lang"),
+        QStringLiteral("Translation input language."), QStringLiteral("id")};
+    QCommandLineOption mnt_out_lang_opt{
+        QStringLiteral("mnt-out-lang"),
+        QStringLiteral("Translation output language."), QStringLiteral("id")};
+
+    parser.addOptions({service_opt, clients_opt, duration_opt, think_opt,
+                       report_opt, audio_opt, text_opt, stt_lang_opt,
+                       tts_lang_opt, mnt_lang_opt, mnt_out_lang_opt});
+    parser.process(app);
+
+    options_t options;
+    if (parser.isSet(service_opt)) options.service = parser.value(service_opt);
+    if (parser.isSet(clients_opt))
+        options.clients = std::max(1, parser.value(clients_opt).toInt());
+    if (parser.isSet(duration_opt))
+        options.duration = std::max(1, parser.value(duration_opt).toInt());
+    if (parser.isSet(think_opt))
+        options.think_time = std::max(0, parser.value(think_opt).toInt());
+    if (parser.isSet(report_opt))
+        options.report_interval = std::max(1, parser.value(report_opt).toInt());
+    if (parser.isSet(audio_opt)) options.audio_file = parser.value(audio_opt);
+    if (parser.isSet(text_opt)) options.text = parser.value(text_opt);
+    options.stt_lang = parser.value(stt_lang_opt);
+    options.tts_lang = parser.value(tts_lang_opt);
+    options.mnt_lang = parser.value(mnt_lang_opt);
+    options.mnt_out_lang = parser.value(mnt_out_lang_opt);
+
+    return options;
+}
+
+static bool wait_for_service(const QString &service) {
+    auto *bus = QDBusConnection::sessionBus().interface();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    while (!bus->isServiceRegistered(service).value()) {
+        if (timer.elapsed() > 60000) return false;
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 100);
+    }
+
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app{argc, argv};
+
+    auto options = parse_options(app);
+
+    if (!wait_for_service(options.service)) {
+        std::fprintf(stderr, "service is not available: %s\n",
+                     qPrintable(options.service));
+        return 2;
+    }
+
+    stats_t stats;
+    auto rss_start = service_rss_kb(options.service);
+    auto start = clock_type::now();
+    int exit_code = 0;
+
+    std::vector<std::unique_ptr<client>> clients;
+    for (int i = 0; i < options.clients; ++i) {
+        clients.push_back(std::make_unique<client>(i, options, stats));
+        clients.back()->start();
+    }
+
+    QTimer report_timer;
+    QObject::connect(&report_timer, &QTimer::timeout, [&] {
+        if (!QDBusConnection::sessionBus()
+                 .interface()
+                 ->isServiceRegistered(options.service)
+                 .value()) {
+            std::fprintf(stderr, "service disappeared\n");
+            exit_code = 1;
+            app.quit();
+            return;
+        }
+
+        print_report(stats, ms_since(start) / 1000.0, rss_start,
+                     service_rss_kb(options.service));
+    });
+    report_timer.start(options.report_interval * 1000);
+
+    QTimer::singleShot(options.duration * 1000, &app, [&] {
+        for (auto &c : clients) c->stop();
+        app.quit();
+    });
+
+    app.exec();
+
+    std::printf("final report:\n");
+    print_report(stats, ms_since(start) / 1000.0, rss_start,
+                 service_rss_kb(options.service));
+
+    return exit_code;
+}
@@ -0,0 +1,40 @@
+#!/usr/bin/bash
+
+# Runs speech service and dbus_load_test on a private session bus.
+#
+# usage: run_dbus_load_test.sh <dsnote binary> <dbus_load_test binary> [dbus_load_test options]
+#
+# DSNOTE_LOAD_TEST_HOME - directory used as home of the service, it should
+#                         contain small models already downloaded
+#                         (e.g. ~/.local/share/net.mkiol/dsnote/models),
+#                         when not set, temporary empty directory is used
+
+dsnote_bin="$1"
+load_test_bin="$2"
+shift 2
+
+if [ ! -x "${dsnote_bin}" ] || [ ! -x "${load_test_bin}" ]; then
+    echo "usage: $0 <dsnote binary> <dbus_load_test binary> [options]"
+    exit 1
+fi
+
+home_dir="${DSNOTE_LOAD_TEST_HOME}"
+if [ -z "${home_dir}" ]; then
+    home_dir="$(mktemp -d)"
+    trap 'rm -Rf "${home_dir}"' EXIT
+fi
+
+HOME="${home_dir}" \
+XDG_DATA_HOME="${home_dir}/.local/share" \
+XDG_CONFIG_HOME="${home_dir}/.config" \
+XDG_CACHE_HOME="${home_dir}/.cache" \
+dbus-run-session -- bash -c '
+    "$1" --service &
+    service_pid=$!
+    shift
+    "$@"
+    result=$?
+    kill "${service_pid}"
+    wait "${service_pid}"
+    exit "${result}"
+' run_dbus_load_test "${dsnote_bin}" "${load_test_bin}" "$@"
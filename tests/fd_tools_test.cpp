@@ -0,0 +1,68 @@
+/* Copyright (C) 2023 Michal Kosciesza <michal@mkiol.net>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "fd_tools.hpp"
+
+#include <unistd.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+TEST_CASE("fd_tools", "[text_fd]") {
+    SECTION("sealed memfd") {
+        std::string text(200000, 'a');
+        text.append("zażółć gęślą jaźń");
+
+        auto fd = fd_tools::make_text_fd(text);
+        REQUIRE(fd >= 0);
+
+        auto read_text = fd_tools::read_text(fd);
+        close(fd);
+
+        REQUIRE(read_text);
+        REQUIRE(*read_text == text);
+    }
+
+    SECTION("empty text") {
+        auto fd = fd_tools::make_text_fd({});
+        REQUIRE(fd >= 0);
+
+        auto read_text = fd_tools::read_text(fd);
+        close(fd);
+
+        REQUIRE(read_text);
+        REQUIRE(read_text->empty());
+    }
+
+    SECTION("too large text") {
+        std::string text(1000, 'a');
+
+        auto fd = fd_tools::make_text_fd(text);
+        REQUIRE(fd >= 0);
+
+        auto read_text = fd_tools::read_text(fd, text.size() - 1);
+        close(fd);
+
+        REQUIRE_FALSE(read_text);
+    }
+
+    SECTION("pipe is rejected") {
+        int fds[2];
+        REQUIRE(pipe(fds) == 0);
+
+        // write end is not closed, reading would block
+        std::string text{"hello world"};
+        REQUIRE(write(fds[1], text.data(), text.size()) ==
+                static_cast<ssize_t>(text.size()));
+
+        auto read_text = fd_tools::read_text(fds[0]);
+        close(fds[0]);
+        close(fds[1]);
+
+        REQUIRE_FALSE(read_text);
+    }
+}
@@ -0,0 +1,83 @@
+/* Copyright (C) 2023 Michal Kosciesza <michal@mkiol.net>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "power_tools.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+static void write_file(const std::filesystem::path& file,
+                       const std::string& value) {
+    std::filesystem::create_directories(file.parent_path());
+    std::ofstream{file} << value << '\n';
+}
+
+TEST_CASE("power_tools", "[power_source]") {
+    auto dir = std::filesystem::temp_directory_path() / "dsnote_power_test";
+    std::filesystem::remove_all(dir);
+
+    SECTION("no power supply") {
+        REQUIRE(power_tools::power_source(dir.string()) ==
+                power_tools::power_source_t::unknown);
+    }
+
+    SECTION("on ac") {
+        write_file(dir / "power_supply/AC/type", "Mains");
+        write_file(dir / "power_supply/AC/online", "1");
+        write_file(dir / "power_supply/BAT0/type", "Battery");
+        write_file(dir / "power_supply/BAT0/status", "Charging");
+
+        REQUIRE(power_tools::power_source(dir.string()) ==
+                power_tools::power_source_t::ac);
+    }
+
+    SECTION("on battery") {
+        write_file(dir / "power_supply/AC/type", "Mains");
+        write_file(dir / "power_supply/AC/online", "0");
+        write_file(dir / "power_supply/BAT0/type", "Battery");
+        write_file(dir / "power_supply/BAT0/status", "Discharging");
+
+        REQUIRE(power_tools::power_source(dir.string()) ==
+                power_tools::power_source_t::battery);
+    }
+
+    SECTION("peripheral battery is ignored") {
+        write_file(dir / "power_supply/hidpp_battery_0/type", "Battery");
+        write_file(dir / "power_supply/hidpp_battery_0/scope", "Device");
+        write_file(dir / "power_supply/hidpp_battery_0/status",
+                   "Discharging");
+
+        REQUIRE(power_tools::power_source(dir.string()) ==
+                power_tools::power_source_t::unknown);
+    }
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("power_tools", "[thermal_throttled]") {
+    auto dir = std::filesystem::temp_directory_path() / "dsnote_thermal_test";
+    std::filesystem::remove_all(dir);
+
+    write_file(dir / "thermal/thermal_zone0/trip_point_0_type", "critical");
+    write_file(dir / "thermal/thermal_zone0/trip_point_0_temp", "105000");
+    write_file(dir / "thermal/thermal_zone0/trip_point_1_type", "passive");
+    write_file(dir / "thermal/thermal_zone0/trip_point_1_temp", "90000");
+
+    SECTION("below passive trip point") {
+        write_file(dir / "thermal/thermal_zone0/temp", "60000");
+        REQUIRE_FALSE(power_tools::thermal_throttled(dir.string()));
+    }
+
+    SECTION("above passive trip point") {
+        write_file(dir / "thermal/thermal_zone0/temp", "95000");
+        REQUIRE(power_tools::thermal_throttled(dir.string()));
+    }
+
+    std::filesystem::remove_all(dir);
+}
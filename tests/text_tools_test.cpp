@@ -101,3 +101,62 @@ TEST_CASE("text_tools", "[trim_lines]") {
         REQUIRE(text == "Hello.\nHow are you?");
     }
 }
+
+TEST_CASE("text_tools", "[subrip_segments]") {
+    SECTION("round trip") {
+        std::string text =
+            "1\n00:00:01,000 --> 00:00:02,000\nHello.\n\n"
+            "2\n00:00:03,000 --> 00:00:04,000\nHow are\nyou?\n\n";
+
+        auto segments = text_tools::subrip_text_to_segments(text);
+
+        REQUIRE(segments.size() == 2);
+        REQUIRE(segments[0].id == "1");
+        REQUIRE(segments[0].timestamp == "00:00:01,000 --> 00:00:02,000");
+        REQUIRE(segments[0].text == "Hello.");
+        REQUIRE(segments[1].text == "How are you?");
+        REQUIRE(segments[1].line_count == 2);
+
+        REQUIRE(text_tools::segments_to_subrip_text(segments) == text);
+    }
+
+    SECTION("crlf and missing trailing line") {
+        std::string text =
+            "1\r\n00:00:01,000 --> 00:00:02,000\r\nHello.\r\n\r\n"
+            "2\r\n00:00:03,000 --> 00:00:04,000\r\nBye.";
+
+        auto segments = text_tools::subrip_text_to_segments(text);
+
+        REQUIRE(segments.size() == 2);
+        REQUIRE(segments[0].text == "Hello.");
+        REQUIRE(segments[1].id == "2");
+        REQUIRE(segments[1].text == "Bye.");
+    }
+
+    SECTION("cue without timestamp") {
+        std::string text =
+            "1\n00:00:01,000 --> 00:00:02,000\nHello.\n\n"
+            "2\nHow are\nyou?\n\n";
+
+        auto segments = text_tools::subrip_text_to_segments(text);
+
+        REQUIRE(segments.size() == 2);
+        REQUIRE(segments[1].id == "2");
+        REQUIRE(segments[1].timestamp.empty());
+        REQUIRE(segments[1].text == "How are you?");
+
+        REQUIRE(text_tools::segments_to_subrip_text(segments) == text);
+    }
+
+    SECTION("markup") {
+        std::string text =
+            "1\n00:00:01,000 --> 00:00:02,000\n<i>Hello.</i>\n\n"
+            "2\n00:00:03,000 --> 00:00:04,000\n1 < 2\n\n";
+
+        auto segments = text_tools::subrip_text_to_segments(text);
+
+        REQUIRE(segments.size() == 2);
+        REQUIRE(segments[0].markup);
+        REQUIRE_FALSE(segments[1].markup);
+    }
+}
@@ -33,3 +33,30 @@ TEST_CASE("vad", "[shift_left]") {
         REQUIRE(buf.empty());
     }
 }
+
+TEST_CASE("vad", "[window]") {
+    vad v;
+
+    SECTION("default window") { REQUIRE(v.window_msec() == 750); }
+
+    SECTION("custom window") {
+        v.set_window_msec(300);
+        REQUIRE(v.window_msec() == 300);
+        REQUIRE(v.m_chunks_in_frame == 10);
+    }
+
+    SECTION("window shorter than chunk") {
+        v.set_window_msec(10);
+        REQUIRE(v.window_msec() == 30);
+    }
+
+    SECTION("reset to default window") {
+        v.set_window_msec(300);
+        v.set_window_msec(0);
+        REQUIRE(v.window_msec() == 750);
+    }
+
+    SECTION("max continuous window") {
+        REQUIRE(vad::max_continuous_window_msec() == 300);
+    }
+}